@@ -16,3 +16,7 @@ int testfunc3(int *a) {
 int natural_sub(intptr_t a, intptr_t b) {
     return a-b;
 }
+int aligned_call(int a) {
+    // rsp is 16 byte aligned at call, so rbp pushed by this function is too.
+    return ((uintptr_t)__builtin_frame_address(0) & 15) == 0 ? a : -1000;
+}
@@ -5,9 +5,14 @@
 #include <string.h>
 #include "rrcc.h"
 
+typedef struct SwitchCases SwitchCases;
+typedef struct ColdBlock ColdBlock;
+
 int cur_label = 0;
 static const int args_reg_len = 6;
 static const char *args_regs[] = {"rdi", "rsi", "rdx", "rcx", "r8", "r9"};
+// Registers holding variables, indexed by LVar.reg - 1. The first four are callee saved.
+static const char *reg_vars[] = {"rbx", "r12", "r13", "r14", "r10", "r11"};
 
 int stack_base = 0;
 int switch_number = 0;
@@ -15,7 +20,16 @@ int current_break_target = 0;
 Vector *break_target_vec;
 int current_continue_target = 0;
 Vector *continue_target_vec;
+Vector *switch_number_vec;
+Vector *inline_return_vec;
+// Function being generated and its label jumped to by recursive tail calls.
+Node *tail_call_func;
+int tail_call_label = 0;
+// Callee saved registers pushed by the prologue of the current function.
+Vector *saved_regs;
 int reserverd_stack_size = 0;
+// Jump tables are used for switch statements with at most this many entries.
+static const int switch_table_max = 4096;
 Vector *file_no_vec;
 
 int stack_align(int size) {
@@ -30,51 +44,127 @@ char *access_size(int size) {
     return "unknown";
 }
 
-void gen_initexpr(Type *type, Node *init_expr_node) {
-    int zero_size = type_sizeof(type);
-    if(init_expr_node) {
-        if(type_is_scalar(type)) {
-            int size = type_sizeof(type);
-            if(init_expr_node->kind == ND_NUM) {
-                int64_t val = init_expr_node->val;
+// Returns the label number of literal. Only literals referenced by the emitted code are output.
+static int string_literal_label(StringLiteral *literal) {
+    literal->used = true;
+    return literal->index;
+}
+
+// Zero bytes not emitted yet. Runs of zeros across elements are merged into one .zero.
+int initexpr_zero_size = 0;
+
+static void gen_initexpr_flush_zero() {
+    if(initexpr_zero_size) {
+        printf("  .zero %d\n", initexpr_zero_size);
+        initexpr_zero_size = 0;
+    }
+}
+
+static char *data_directive(int size) {
+    if(size == 1) return ".byte";
+    if(size == 2) return ".short";
+    if(size == 4) return ".long";
+    if(size == 8) return ".quad";
+    return NULL;
+}
+
+static void gen_initexpr_data(Type *type, Node *init_expr_node) {
+    int size = type_sizeof(type);
+    if(!init_expr_node) {
+        initexpr_zero_size += size;
+        return;
+    }
+    if(type_is_scalar(type)) {
+        init_expr_node = constant_fold(init_expr_node);
+        if(init_expr_node->kind == ND_NUM && init_expr_node->val == 0) {
+            initexpr_zero_size += size;
+        }else if(init_expr_node->kind == ND_NUM) {
+            gen_initexpr_flush_zero();
+            unsigned long val = init_expr_node->val;
+            char *directive = data_directive(size);
+            if(directive) {
+                if(size < 8) {
+                    val &= (1UL << (size * 8)) - 1;
+                }
+                printf("  %s %lu\n", directive, val);
+            }else {
                 char *buf = (char *)&val;
                 for(int i = 0; i < size; i++){
-                    printf("  .byte %d\n", (unsigned char)buf[i]);
+                    printf("  .byte %d\n", (unsigned char)(i < 8 ? buf[i] : 0));
                 }
-            }else if(init_expr_node->kind == ND_STRING_LITERAL) {
-                printf("  .quad .L_S_%d\n", init_expr_node->string_literal.literal->index);
-            }
-            zero_size -= size;
-        }else if(type->ty == STRUCT) {
-            if(init_expr_node->kind != ND_INIT) {
-                error("Initializer type mismatch.");
-            }
-            Vector *init_expr = init_expr_node->init.init_expr;
-            for(int i = 0; i < vector_size(init_expr); i++) {
-                Node *node = vector_get(init_expr, i);
-                StructMember *member = vector_get(type->members, i);
-                int s = type_sizeof(member->type);
-
-                gen_initexpr(member->type, node);
-                zero_size -= s;
             }
+        }else if(init_expr_node->kind == ND_STRING_LITERAL) {
+            gen_initexpr_flush_zero();
+            printf("  .quad .L_S_%d\n", string_literal_label(init_expr_node->string_literal.literal));
         }else {
-            Vector *init_expr = init_expr_node->init.init_expr;
-            int len = vector_size(init_expr);
-            for(int i = 0; i < len; i++) {
-                Node *node = vector_get(init_expr, i);
-
-                gen_initexpr(type->ptr_to, node);
-            }
-            int s = type_sizeof(type->ptr_to);
-            zero_size -= s * len;
+            initexpr_zero_size += size;
+        }
+    }else if(type->ty == STRUCT) {
+        if(init_expr_node->kind != ND_INIT) {
+            error("Initializer type mismatch.");
         }
+        Vector *init_expr = init_expr_node->init.init_expr;
+        int offset = 0;
+        for(int i = 0; i < vector_size(init_expr); i++) {
+            Node *node = vector_get(init_expr, i);
+            StructMember *member = vector_get(type->members, i);
+            initexpr_zero_size += member->offset - offset;
+            gen_initexpr_data(member->type, node);
+            offset = member->offset + type_sizeof(member->type);
+        }
+        initexpr_zero_size += size - offset;
+    }else {
+        Vector *init_expr = init_expr_node->init.init_expr;
+        int len = vector_size(init_expr);
+        for(int i = 0; i < len; i++) {
+            gen_initexpr_data(type->ptr_to, vector_get(init_expr, i));
+        }
+        initexpr_zero_size += size - type_sizeof(type->ptr_to) * len;
     }
-    if(zero_size) {
-        printf("  .zero %d\n", zero_size);
+}
+
+void gen_initexpr(Type *type, Node *init_expr_node) {
+    gen_initexpr_data(type, init_expr_node);
+    gen_initexpr_flush_zero();
+}
+
+// Bytes pushed since the entry of the current function, including the return address.
+// The code is structured, so the depth at each instruction is known statically.
+int stack_depth = 0;
+// Deepest stack_depth in the current function, which is its stack usage.
+int max_stack_depth = 0;
+// Whether the CFA is described relative to rsp, which is the case in functions without rbp
+// and in prologues. Then every change of stack_depth is reported to the unwinder.
+bool cfa_on_rsp = false;
+
+// CFA offset from rbp in functions with a frame.
+int frame_cfa_offset = 0;
+
+static void gen_cfa() {
+    if(cfa_on_rsp) {
+        printf("  .cfi_def_cfa_offset %d\n", stack_depth);
     }
 }
 
+static void grow_stack(int size) {
+    stack_depth += size;
+    if(max_stack_depth < stack_depth) {
+        max_stack_depth = stack_depth;
+    }
+    gen_cfa();
+}
+
+static void gen_push(char *operand) {
+    printf("  push %s\n", operand);
+    grow_stack(8);
+}
+
+static void gen_pop(char *operand) {
+    printf("  pop %s\n", operand);
+    stack_depth -= 8;
+    gen_cfa();
+}
+
 // lvar->offset indicates storage size in byte which the variables above this variable occupy.
 // When we use rbp - (sub offset) to access this variable, we must add the size of this variable.
 int get_stack_sub_offset(LVar *lvar) {
@@ -82,21 +172,24 @@ int get_stack_sub_offset(LVar *lvar) {
 }
 
 void gen_lvar(Node *node) {
+    if(node->kind == ND_LVAR && node->lvar->reg) {
+        error("Address of register variable %.*s is requested.", node->lvar->len, node->lvar->name);
+    }
     if(node->kind == ND_LVAR) {
         printf("  // access %.*s\n", node->lvar->len, node->lvar->name);
         printf("  mov rax, rbp\n");
         printf("  sub rax,%d\n", get_stack_sub_offset(node->lvar));
-        printf("  push rax\n");
+        gen_push("rax");
     }else if(node->kind == ND_GVAR) {
         printf("  lea rax, [rip + %.*s]\n", node->gvar.gvar->len, node->gvar.gvar->name);
-        printf("  push rax\n");
+        gen_push("rax");
     } else if(node->kind == ND_DEREF) {
         gen(node->lhs);
     }
 }
 
 void load(int size) {
-    printf("  pop rax\n");
+    gen_pop("rax");
     switch(size) {
         case 1:
             printf("  mov al, %s[rax]\n", access_size(size));
@@ -114,27 +207,125 @@ void load(int size) {
             printf("  mov rax, %s[rax]\n", access_size(size));
             break;
     }
-    printf("  push rax\n");
+    gen_push("rax");
 }
 
 void store(int size) {
-    printf("  pop rbx\n");
-    printf("  pop rax\n");
+    gen_pop("rdi");
+    gen_pop("rax");
     switch(size) {
         case 1:
-            printf("  mov %s [rax], bl\n", access_size(size));
+            printf("  mov %s [rax], dil\n", access_size(size));
             break;
         case 2:
-            printf("  mov %s [rax], bx\n", access_size(size));
+            printf("  mov %s [rax], di\n", access_size(size));
             break;
         case 4:
-            printf("  mov %s [rax], ebx\n", access_size(size));
+            printf("  mov %s [rax], edi\n", access_size(size));
             break;
         case 8:
-            printf("  mov %s [rax], rbx\n", access_size(size));
+            printf("  mov %s [rax], rdi\n", access_size(size));
             break;
     }
-    printf("  push rbx\n");
+    gen_push("rdi");
+}
+
+// Sign extends the lower size bytes of rax as load() does.
+static void gen_sign_extend_rax(int size) {
+    if(size == 1) {
+        printf("  movsx rax, al\n");
+    }else if(size == 2) {
+        printf("  movsx rax, ax\n");
+    }else if(size == 4) {
+        printf("  movsx rax, eax\n");
+    }
+}
+
+// Stores rax to the register holding lvar.
+static void gen_store_reg_var(LVar *lvar) {
+    gen_sign_extend_rax(type_sizeof(lvar->type));
+    printf("  mov %s, rax\n", reg_vars[lvar->reg - 1]);
+}
+
+// Larger copies and fills use rep movsb and rep stosb.
+static const int bulk_unroll_max = 256;
+
+// Whether values of type are addresses of objects copied by gen_copy().
+static bool is_aggregate_value(Type *type) {
+    if(type->ty == ARRAY) {
+        return true;
+    }
+    int size = type_sizeof(type);
+    return (type->ty == STRUCT || type->ty == UNION) && size != 1 && size != 2 && size != 4 && size != 8;
+}
+
+// Moves with registers of decreasing width for a tail shorter than 16 bytes.
+static void gen_copy_tail(int offset, int size) {
+    int widths[] = {8, 4, 2, 1};
+    char *regs[] = {"rax", "eax", "ax", "al"};
+    for(int i = 0; i < 4; i++) {
+        while(size >= widths[i]) {
+            printf("  mov %s, %s [rsi+%d]\n", regs[i], access_size(widths[i]), offset);
+            printf("  mov %s [rdi+%d], %s\n", access_size(widths[i]), offset, regs[i]);
+            offset += widths[i];
+            size -= widths[i];
+        }
+    }
+}
+
+// Copies size bytes from [rsi] to [rdi]. Clobbers rax, rcx, rsi, rdi and xmm0.
+static void gen_copy(int size) {
+    printf("  // copy %d bytes\n", size);
+    if(size > bulk_unroll_max) {
+        printf("  mov rcx, %d\n", size);
+        printf("  rep movsb\n");
+        return;
+    }
+    int offset = 0;
+    for(; offset + 16 <= size; offset += 16) {
+        printf("  movdqu xmm0, [rsi+%d]\n", offset);
+        printf("  movdqu [rdi+%d], xmm0\n", offset);
+    }
+    if(offset < size && size >= 16) {
+        // The last 16 bytes overlap with the ones already copied.
+        printf("  movdqu xmm0, [rsi+%d]\n", size - 16);
+        printf("  movdqu [rdi+%d], xmm0\n", size - 16);
+    }else {
+        gen_copy_tail(offset, size - offset);
+    }
+}
+
+// Fills size bytes at [rdi] with zero. Clobbers rax, rcx, rdi and xmm0.
+static void gen_zero(int size) {
+    printf("  // zero %d bytes\n", size);
+    if(size > bulk_unroll_max) {
+        printf("  xor eax, eax\n");
+        printf("  mov rcx, %d\n", size);
+        printf("  rep stosb\n");
+        return;
+    }
+    int offset = 0;
+    if(size >= 16) {
+        printf("  pxor xmm0, xmm0\n");
+    }
+    for(; offset + 16 <= size; offset += 16) {
+        printf("  movdqu [rdi+%d], xmm0\n", offset);
+    }
+    if(offset < size && size >= 16) {
+        printf("  movdqu [rdi+%d], xmm0\n", size - 16);
+        return;
+    }
+    int widths[] = {8, 4, 2, 1};
+    for(int i = 0; i < 4; i++) {
+        while(size - offset >= widths[i]) {
+            printf("  mov %s [rdi+%d], 0\n", access_size(widths[i]), offset);
+            offset += widths[i];
+        }
+    }
+}
+
+static bool is_reg_var(Node *node) {
+    return node->kind == ND_LVAR && node->lvar->reg;
 }
 
 void gen_lowering_rax(int to_size) {
@@ -149,21 +340,207 @@ void gen_lowering_rax(int to_size) {
     }
 }
 
-void gen_return() {
-    printf("  pop rax\n");
-    printf("  mov rsp,rbp\n");
+// Restores callee saved registers. The stack machine must be empty.
+static void gen_epilogue() {
+    if(tail_call_func->func_def.uses_frame) {
+        printf("  mov rsp,rbp\n");
+    }
+    for(int i = vector_size(saved_regs) - 1; i >= 0; i--) {
+        gen_pop((char*)vector_get(saved_regs, i));
+    }
+    if(tail_call_func->func_def.uses_frame) {
+        gen_pop("rbp");
+        printf("  .cfi_def_cfa rsp, 8\n");
+    }
+}
+
+// Counts an execution of the slot-th counter of node with -fprofile-generate.
+// Counters follow the checksum and counter count in .Lprof_counters. Flags are clobbered.
+static void gen_profile_counter(Node *node, int slot) {
+    if(profile_generate && node->prof_counter) {
+        printf("  inc qword ptr [rip + .Lprof_counters+%d]\n", (node->prof_counter + 1 + slot) * 8);
+    }
+}
+
+// Emits str as a .string directive. Quotes, backslashes and control characters are escaped.
+static void gen_string_directive(char *str) {
+    printf("  .string \"");
+    for(char *p = str; *p; p++) {
+        unsigned char c = *p;
+        if(c == '"' || c == '\\') {
+            printf("\\%c", c);
+        }else if(c < 0x20 || c >= 0x7f) {
+            printf("\\%03o", c);
+        }else {
+            printf("%c", c);
+        }
+    }
+    printf("\"\n");
+}
+
+// Emits the counters and a destructor which adds them to the profile file when the program exits.
+// A profile of another build of the source is overwritten.
+static void gen_profile_runtime() {
+    int size = profile_counters + 2;
+    printf(".data\n");
+    printf(".align 8\n");
+    printf(".Lprof_counters:\n");
+    printf("  .quad %lu\n", profile_checksum);
+    printf("  .quad %d\n", profile_counters);
+    printf("  .zero %d\n", profile_counters * 8);
+    printf(".bss\n");
+    printf(".align 8\n");
+    printf(".Lprof_old:\n");
+    printf("  .zero %d\n", size * 8);
+    printf(".section .rodata\n");
+    printf(".Lprof_path:\n");
+    gen_string_directive(profile_path);
+    printf(".Lprof_read:\n");
+    printf("  .string \"rb\"\n");
+    printf(".Lprof_write:\n");
+    printf("  .string \"wb\"\n");
+    printf(".text\n");
+    printf(".Lprof_dump:\n");
+    printf("  push rbx\n");
+    printf("  lea rdi, [rip + .Lprof_path]\n");
+    printf("  lea rsi, [rip + .Lprof_read]\n");
+    printf("  call fopen\n");
+    printf("  test rax, rax\n");
+    printf("  je .Lprof_dump_write\n");
+    printf("  mov rbx, rax\n");
+    printf("  lea rdi, [rip + .Lprof_old]\n");
+    printf("  mov esi, 8\n");
+    printf("  mov edx, %d\n", size);
+    printf("  mov rcx, rbx\n");
+    printf("  call fread\n");
+    printf("  mov rdi, rbx\n");
+    printf("  call fclose\n");
+    printf("  lea rsi, [rip + .Lprof_old]\n");
+    printf("  lea rdi, [rip + .Lprof_counters]\n");
+    printf("  mov rax, [rsi]\n");
+    printf("  cmp rax, [rdi]\n");
+    printf("  jne .Lprof_dump_write\n");
+    printf("  mov rax, [rsi+8]\n");
+    printf("  cmp rax, [rdi+8]\n");
+    printf("  jne .Lprof_dump_write\n");
+    printf("  mov ecx, 2\n");
+    printf(".Lprof_dump_merge:\n");
+    printf("  cmp rcx, %d\n", size);
+    printf("  jae .Lprof_dump_write\n");
+    printf("  mov rax, [rsi+rcx*8]\n");
+    printf("  add [rdi+rcx*8], rax\n");
+    printf("  inc rcx\n");
+    printf("  jmp .Lprof_dump_merge\n");
+    printf(".Lprof_dump_write:\n");
+    printf("  lea rdi, [rip + .Lprof_path]\n");
+    printf("  lea rsi, [rip + .Lprof_write]\n");
+    printf("  call fopen\n");
+    printf("  test rax, rax\n");
+    printf("  je .Lprof_dump_end\n");
+    printf("  mov rbx, rax\n");
+    printf("  lea rdi, [rip + .Lprof_counters]\n");
+    printf("  mov esi, 8\n");
+    printf("  mov edx, %d\n", size);
+    printf("  mov rcx, rbx\n");
+    printf("  call fwrite\n");
+    printf("  mov rdi, rbx\n");
+    printf("  call fclose\n");
+    printf(".Lprof_dump_end:\n");
     printf("  pop rbx\n");
-    printf("  pop r15\n");
-    printf("  pop rbp\n");
     printf("  ret\n");
+    printf(".Lprof_init:\n");
+    printf("  lea rdi, [rip + .Lprof_dump]\n");
+    printf("  jmp atexit\n");
+    printf(".section .init_array,\"aw\"\n");
+    printf(".align 8\n");
+    printf("  .quad .Lprof_init\n");
 }
 
+// Calls hook(this_fn, call_site) of -finstrument-functions. Argument registers are clobbered.
+static void gen_profile_hook(char *hook) {
+    Node *func = tail_call_func;
+    printf("  lea rdi, [rip + %.*s]\n", func->func_def.ident_len, func->func_def.ident);
+    // The return address of the current function
+    printf("  mov rsi, qword ptr [rsp+%d]\n", stack_depth - 8);
+    int pad = stack_depth % 16;
+    if(pad) {
+        printf("  sub rsp,%d\n", pad);
+        grow_stack(pad);
+    }
+    printf("  call %s\n", hook);
+    if(pad) {
+        printf("  add rsp,%d\n", pad);
+        stack_depth -= pad;
+        gen_cfa();
+    }
+}
+
+void gen_return() {
+    if(is_instrumented(tail_call_func)) {
+        // The return value stays on the stack during the hook.
+        gen_profile_hook("__cyg_profile_func_exit");
+    }
+    gen_pop("rax");
+    // The code after ret continues with the unwind state of the function body.
+    printf("  .cfi_remember_state\n");
+    gen_epilogue();
+    printf("  ret\n");
+    printf("  .cfi_restore_state\n");
+}
+
+static bool string_literal_has_nul(StringLiteral *literal) {
+    for(int i = 0; i < vector_size(literal->char_vec); i++) {
+        if(vector_get(literal->char_vec, i) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Literals without a NUL inside are put in a mergeable section so that the linker
+// can share identical strings across objects.
 static void gen_string_literals() {
-    printf(".data\n");
-    for(int i = 0; i < vector_size(global_string_literals); i++) {
-        StringLiteral *literal = vector_get(global_string_literals, i);
-        printf(".L_S_%d:\n", literal->index);
-        printf("  .string \"%.*s\"\n", literal->len, literal->str);
+    for(int mergeable = 1; mergeable >= 0; mergeable--) {
+        printf(mergeable ? ".section .rodata.str1.1,\"aMS\",@progbits,1\n" : ".section .rodata\n");
+        for(int i = 0; i < vector_size(global_string_literals); i++) {
+            StringLiteral *literal = vector_get(global_string_literals, i);
+            if(!literal->used || string_literal_has_nul(literal) == mergeable) {
+                continue;
+            }
+            printf(".L_S_%d:\n", literal->index);
+            printf("  .string \"%.*s\"\n", literal->len, literal->str);
+        }
+    }
+}
+
+// Read-only images copied into local aggregates by their initializers.
+static void gen_init_templates() {
+    printf(".section .rodata\n");
+    for(int i = 0; i < vector_size(init_templates); i++) {
+        Node *node = vector_get(init_templates, i);
+        printf("%.*s:\n", node->gvar_def.gvar->len, node->gvar_def.gvar->name);
+        gen_initexpr(node->gvar_def.gvar->type, node->gvar_def.init_expr);
+    }
+}
+
+// Output of -fstack-usage, and the threshold of -Wframe-larger-than (negative if disabled).
+char *stack_usage_path = NULL;
+FILE *stack_usage_file = NULL;
+int frame_larger_than = -1;
+
+// The stack usage includes the return address, saved registers, the frame, and
+// the deepest temporaries and outgoing arguments. Frames are always static
+// since there are no variable length arrays or alloca.
+static void report_stack_usage(Node *node) {
+    LineInfo *line_info = node->line_info;
+    if(stack_usage_file) {
+        fprintf(stack_usage_file, "%.*s:%d:%.*s\t%d\tstatic\n", line_info->filename_len, line_info->filename,
+                line_info->line_number, node->func_def.ident_len, node->func_def.ident, max_stack_depth);
+    }
+    if(frame_larger_than >= 0 && max_stack_depth > frame_larger_than) {
+        fprintf(stderr, "%.*s:%d: warning: the frame size of %d bytes of %.*s is larger than %d bytes\n",
+                line_info->filename_len, line_info->filename, line_info->line_number,
+                max_stack_depth, node->func_def.ident_len, node->func_def.ident, frame_larger_than);
     }
 }
 
@@ -172,23 +549,1069 @@ void gen_builtin_call(Node *node) {
     if(strcmp(gvar->name, "__builtin_va_start") == 0) {
         printf("  // __builtin_va_start\n");
         gen(node->call_arg_list.next->node);
-        Node *arg2 = node->call_arg_list.next->next->node;
         int gp_offset = 0, fp_offset = 0;
-        gp_offset = (arg2->lvar->func_arg_index - 1) * 8 + 8;
+        int named = vector_size(tail_call_func->func_def.arg_vec);
+        int stack_named = named > args_reg_len ? named - args_reg_len : 0;
+        gp_offset = (named - stack_named) * 8;
         printf("  mov dword ptr[rax], %d\n", gp_offset);
         printf("  mov dword ptr[rax+4], %d\n", fp_offset);
-        printf("  lea rcx, [rbp+%d]\n", 4 * 8);
+        printf("  lea rcx, [rbp+%d]\n", (vector_size(saved_regs) + 2 + stack_named) * 8);
         printf("  mov qword ptr[rax+8], rcx\n"); // overflow_arg_area
         printf("  lea rcx, [rbp-%d]\n", 6 * 8);
         printf("  mov qword ptr[rax+16], rcx\n"); // reg_save_area
-        printf("  push rax\n");
+        gen_push("rax");
     }else if(strcmp(gvar->name, "__builtin_va_end") == 0) {
-        printf("  push rax\n");
+        gen_push("rax");
+    }else if(strcmp(gvar->name, "__builtin_expect") == 0) {
+        // The hint is used by the block layout. The value is the first argument.
+        gen(node->call_arg_list.next->node);
     }else {
         error("Unknown builtin call %s\n", gvar->name);
     }
 }
 
+// Converts rax from the type of node->lhs to the type of node.
+static void gen_convert_rax(Node *node) {
+    char *out_from, *out_to;
+    type_dump(node->lhs->expr_type, &out_from);
+    type_dump(node->expr_type, &out_to);
+    int from_size = type_sizeof(node->lhs->expr_type);
+    int to_size = type_sizeof(node->expr_type);
+    printf("  // convert from %s to %s\n", out_from, out_to);
+    if(from_size > to_size) {
+        // lowering size
+        gen_lowering_rax(to_size);
+    }else if(from_size < to_size) {
+        // enlarge size
+        if(type_is_signed(node->lhs->expr_type)) {
+            // signed to signed
+            // (signed char)-16 -> (signed short)-16
+            // or, signed to unsigned
+            // (signed char)-16 -> (unsigned short)65520
+            // Whether converting to signed or unsigned, bit representations are the same.
+            if(from_size == 1) {
+                printf("  movsx rax, al\n");
+            } else if(from_size == 2) {
+                printf("  movsx rax, ax\n");
+            } else if(from_size == 4) {
+                printf("  movsx rax, eax\n");
+            } else if(from_size == 8) {
+                error("Conversion unsupported for type %s to %s", out_from, out_to);
+            }
+            gen_lowering_rax(to_size);
+        }else if(!type_is_signed(node->lhs->expr_type) && !type_is_signed(node->expr_type)) {
+            // unsigned to unsigned
+            gen_lowering_rax(from_size);
+        }else {
+            // unsigned to signed
+            gen_lowering_rax(from_size);
+        }
+    }
+}
+
+// Truncates val to size bytes and extends it to 64 bits.
+static unsigned long normalize_value(unsigned long val, int size, bool is_signed) {
+    if(size == 1) {
+        return is_signed ? (unsigned long)(long)(signed char)val : (val & 0xff);
+    }else if(size == 2) {
+        return is_signed ? (unsigned long)(long)(short)val : (val & 0xffff);
+    }else if(size == 4) {
+        return is_signed ? (unsigned long)(long)(int)val : (val & 0xffffffff);
+    }
+    return val;
+}
+
+// If node is an integer constant (possibly converted), stores its value
+// extended to 64 bits according to the type of node.
+static bool get_const_value(Node *node, unsigned long *val) {
+    if(node->kind == ND_NUM) {
+        *val = node->val;
+    }else if(node->kind == ND_CONVERT && type_is_int(node->expr_type) && get_const_value(node->lhs, val)) {
+    }else {
+        return false;
+    }
+    *val = normalize_value(*val, type_sizeof(node->expr_type), type_is_signed(node->expr_type));
+    return true;
+}
+
+static bool is_imm32(unsigned long val) {
+    return (long)val >= -2147483648L && (long)val <= 2147483647L;
+}
+
+// Whether node can be evaluated into rax without side effects or the stack.
+static bool is_simple_expr(Node *node) {
+    unsigned long val;
+    if(get_const_value(node, &val)) {
+        return true;
+    }
+    if(node->expr_type == NULL || node->expr_type->ty == STRUCT || node->expr_type->ty == UNION) {
+        return false;
+    }
+    switch(node->kind) {
+        case ND_STRING_LITERAL:
+        case ND_LVAR:
+        case ND_GVAR:
+            return true;
+        case ND_ADDRESS_OF:
+            return node->lhs->kind == ND_LVAR || node->lhs->kind == ND_GVAR;
+        case ND_CONVERT:
+            return is_simple_expr(node->lhs);
+    }
+    return false;
+}
+
+// Loads a sign extended value of size bytes from addr to reg as load() does.
+static void gen_load_to(char *reg, char *addr, int size) {
+    if(size == 4) {
+        printf("  movsxd %s, dword ptr %s\n", reg, addr);
+    }else if(size == 8) {
+        printf("  mov %s, qword ptr %s\n", reg, addr);
+    }else {
+        printf("  movsx %s, %s %s\n", reg, access_size(size), addr);
+    }
+}
+
+// Sets addr to the memory operand of the variable incremented or decremented by node.
+// Addresses other than of variables are computed to rsi.
+static void gen_incdec_operand(Node *node, char *addr) {
+    Node *var = node->lhs;
+    if(var->kind == ND_LVAR) {
+        sprintf(addr, "[rbp-%d]", get_stack_sub_offset(var->lvar));
+    }else if(var->kind == ND_GVAR) {
+        sprintf(addr, "[rip + %.*s]", var->gvar.gvar->len, var->gvar.gvar->name);
+    }else {
+        gen_lvar(var);
+        gen_pop("rsi");
+        sprintf(addr, "[rsi]");
+    }
+}
+
+// Adds the step of node to the variable at addr in place. rax is preserved.
+static void gen_incdec_memory(Node *node, char *addr) {
+    char *size = access_size(type_sizeof(node->expr_type));
+    if(is_imm32(node->incdec.value)) {
+        printf("  add %s %s, %ld\n", size, addr, node->incdec.value);
+    }else {
+        printf("  mov rcx, %ld\n", node->incdec.value);
+        printf("  add %s %s, rcx\n", size, addr);
+    }
+}
+
+// Evaluates a simple expression to rax.
+static void gen_simple_rax(Node *node) {
+    unsigned long val;
+    if(get_const_value(node, &val)) {
+        printf("  mov rax, %lu\n", val);
+        return;
+    }
+    char addr[64];
+    Node *var = node->kind == ND_ADDRESS_OF ? node->lhs : node;
+    if(var->kind == ND_LVAR && var->lvar->reg) {
+        printf("  mov rax, %s\n", reg_vars[var->lvar->reg - 1]);
+        return;
+    }
+    if(var->kind == ND_LVAR) {
+        sprintf(addr, "[rbp-%d]", get_stack_sub_offset(var->lvar));
+    }else if(var->kind == ND_GVAR) {
+        sprintf(addr, "[rip + %.*s]", var->gvar.gvar->len, var->gvar.gvar->name);
+    }
+    switch(node->kind) {
+        case ND_STRING_LITERAL:
+            printf("  lea rax, .L_S_%d[rip]\n", string_literal_label(node->string_literal.literal));
+            return;
+        case ND_LVAR:
+        case ND_GVAR:
+            if(node->expr_type->ty == ARRAY) {
+                printf("  lea rax, %s\n", addr);
+            }else {
+                gen_load_to("rax", addr, type_sizeof(node->expr_type));
+            }
+            return;
+        case ND_ADDRESS_OF:
+            printf("  lea rax, %s\n", addr);
+            return;
+        case ND_CONVERT:
+            gen_simple_rax(node->lhs);
+            if(!(node->lhs->expr_type->ty == ARRAY && node->expr_type->ty == PTR)) {
+                gen_convert_rax(node);
+            }
+            return;
+    }
+}
+
+// Evaluates arguments of call and moves them to argument registers and the stack area for arguments after the sixth.
+// Arguments which may have side effects are evaluated first in order onto the stack, then each argument is moved
+// to its place. Simple arguments are evaluated there directly. Values in registers never live in argument
+// registers, so the moves need no ordering. Returns the number of bytes to release after the call.
+static int gen_call_args(Node *node) {
+    Vector *args = new_vector();
+    for(NodeList *cur = node->call_arg_list.next; cur; cur = cur->next) {
+        vector_push(args, cur->node);
+    }
+    int nargs = vector_size(args);
+    Vector *slots = new_vector();
+    int pushed = 0;
+    for(int i = 0; i < nargs; i++) {
+        Node *arg = vector_get(args, i);
+        if(is_simple_expr(arg)) {
+            vector_push(slots, (void*)(long)-1);
+        }else {
+            gen(arg);
+            vector_push(slots, (void*)(long)pushed++);
+        }
+    }
+    int stack_args = nargs > args_reg_len ? nargs - args_reg_len : 0;
+    // rsp must be 16 byte aligned at call
+    int area = stack_args * 8 + (stack_depth + stack_args * 8) % 16;
+    if(area) {
+        printf("  sub rsp,%d\n", area);
+        grow_stack(area);
+    }
+    for(int i = nargs - 1; i >= 0; i--) {
+        Node *arg = vector_get(args, i);
+        int slot = (int)(long)vector_get(slots, i);
+        char *reg = i < args_reg_len ? (char*)args_regs[i] : "rax";
+        if(slot >= 0) {
+            printf("  mov %s, qword ptr [rsp+%d]\n", reg, area + (pushed - 1 - slot) * 8);
+        }else {
+            gen_simple_rax(arg);
+            if(i < args_reg_len) {
+                printf("  mov %s, rax\n", reg);
+            }
+        }
+        if(i >= args_reg_len) {
+            printf("  mov qword ptr [rsp+%d], rax\n", (i - args_reg_len) * 8);
+        }
+    }
+    stack_depth -= area + pushed * 8;
+    return area + pushed * 8;
+}
+
+// Replaces the frame of the current function with the callee.
+// Recursive calls jump back to the prologue and reuse the frame.
+static void gen_tail_call(Node *node) {
+    printf("  // tail call %.*s\n", node->call_ident_len, node->call_ident);
+    int size = gen_call_args(node);
+    if(size) {
+        printf("  add rsp,%d\n", size);
+        gen_cfa();
+    }
+    Node *func = tail_call_func;
+    if(!func->func_def.type->is_vararg && func->func_def.ident_len == node->call_ident_len
+            && strncmp(func->func_def.ident, node->call_ident, node->call_ident_len) == 0) {
+        if(func->func_def.uses_frame) {
+            printf("  mov rsp,rbp\n");
+        }
+        printf("  jmp .Ltail_call_%d\n", tail_call_label);
+        return;
+    }
+    printf("  .cfi_remember_state\n");
+    gen_epilogue();
+    // Number of floating point argument
+    printf("  mov al,0\n");
+    printf("  jmp %.*s\n", node->call_ident_len, node->call_ident);
+    printf("  .cfi_restore_state\n");
+}
+
+// Returns k if val == 2^k, otherwise -1.
+static int log2_exact(unsigned long val) {
+    for(int k = 0; k < 64; k++) {
+        if(val == (1UL << k)) {
+            return k;
+        }
+    }
+    return -1;
+}
+
+// Extends a 32-bit operand in rax to 64 bits so that 64-bit division gives the right result.
+static void gen_extend_rax(Type *type) {
+    if(type_sizeof(type) == 4) {
+        if(type_is_signed(type)) {
+            printf("  movsx rax, eax\n");
+        }else {
+            printf("  mov eax, eax\n");
+        }
+    }
+}
+
+// rax = rax * val
+static void gen_mul_const(unsigned long val) {
+    int k = log2_exact(val);
+    if(val == 0) {
+        printf("  xor eax, eax\n");
+    }else if(k >= 0) {
+        if(k > 0) {
+            printf("  shl rax, %d\n", k);
+        }
+    }else if(val % 9 == 0 && log2_exact(val / 9) >= 0) {
+        printf("  lea rax, [rax+rax*8]\n");
+        gen_mul_const(val / 9);
+    }else if(val % 5 == 0 && log2_exact(val / 5) >= 0) {
+        printf("  lea rax, [rax+rax*4]\n");
+        gen_mul_const(val / 5);
+    }else if(val % 3 == 0 && log2_exact(val / 3) >= 0) {
+        printf("  lea rax, [rax+rax*2]\n");
+        gen_mul_const(val / 3);
+    }else if(is_imm32(val)) {
+        printf("  imul rax, rax, %ld\n", (long)val);
+    }else {
+        printf("  mov rsi, %lu\n", val);
+        printf("  imul rax, rsi\n");
+    }
+}
+
+static int ceil_log2(unsigned long val) {
+    int l = 0;
+    while((1UL << l) < val) {
+        l++;
+    }
+    return l;
+}
+
+// floor(r * 2^64 / d) for r < d < 2^31.
+static unsigned long div_shifted(unsigned long r, unsigned long d) {
+    unsigned long q = 0;
+    for(int i = 0; i < 64; i++) {
+        r = r * 2;
+        q = q * 2;
+        if(r >= d) {
+            r = r - d;
+            q = q | 1;
+        }
+    }
+    return q;
+}
+
+// rax = rax / d or rax % d, by shifts or multiplication with a magic number
+// (Granlund and Montgomery, "Division by Invariant Integers using Multiplication").
+// Operand is already extended to 64 bits. Returns false if d is not handled here.
+static bool gen_div_const(unsigned long d, bool is_signed, bool is_mod) {
+    unsigned long abs_d = d;
+    if(is_signed && (long)d < 0) {
+        abs_d = -d;
+    }
+    if(abs_d == 0 || abs_d >= (1UL << 31)) {
+        return false;
+    }
+    // keep dividend for remainder
+    printf("  mov rcx, rax\n");
+    int k = log2_exact(abs_d);
+    int l = ceil_log2(abs_d);
+    if(abs_d == 1) {
+        // nop
+    }else if(!is_signed && k > 0) {
+        if(is_mod) {
+            printf("  and rax, %lu\n", d - 1);
+            return true;
+        }
+        printf("  shr rax, %d\n", k);
+    }else if(!is_signed) {
+        // t1 = mulhi(m, n); q = (t1 + ((n - t1) >> 1)) >> (l - 1)
+        unsigned long m = div_shifted((1UL << l) - d, d) + 1;
+        printf("  mov rsi, %lu\n", m);
+        printf("  mul rsi\n");
+        printf("  mov rax, rcx\n");
+        printf("  sub rax, rdx\n");
+        printf("  shr rax, 1\n");
+        printf("  add rax, rdx\n");
+        printf("  shr rax, %d\n", l - 1);
+    }else if(k > 0) {
+        // round toward zero: add 2^k-1 to negative dividend
+        printf("  mov rdx, rax\n");
+        printf("  sar rdx, 63\n");
+        printf("  shr rdx, %d\n", 64 - k);
+        printf("  add rax, rdx\n");
+        printf("  sar rax, %d\n", k);
+    }else {
+        // q = ((n + mulsh(m, n)) >> (l - 1)) - (n >> 63)
+        unsigned long m = div_shifted(1UL << (l - 1), abs_d) + 1;
+        printf("  mov rsi, %lu\n", m);
+        printf("  imul rsi\n");
+        printf("  add rdx, rcx\n");
+        printf("  sar rdx, %d\n", l - 1);
+        printf("  mov rax, rcx\n");
+        printf("  sar rax, 63\n");
+        printf("  sub rdx, rax\n");
+        printf("  mov rax, rdx\n");
+    }
+    if(is_signed && (long)d < 0) {
+        printf("  neg rax\n");
+    }
+    if(is_mod) {
+        // n - q * d
+        gen_mul_const(d);
+        printf("  sub rcx, rax\n");
+        printf("  mov rax, rcx\n");
+    }
+    return true;
+}
+
+// rax = rax / rsi or rax % rsi. Dividend is already extended to 64 bits.
+static void gen_div(Node *node) {
+    if(type_sizeof(node->expr_type) == 4) {
+        printf("  %s\n", type_is_signed(node->expr_type) ? "movsx rsi, esi" : "mov esi, esi");
+    }
+    if(type_is_signed(node->expr_type)) {
+        printf("  cqto\n");
+        printf("  idiv rsi\n");
+    }else {
+        printf("  xor edx, edx\n");
+        printf("  div rsi\n");
+    }
+    if(node->kind == ND_MOD) {
+        printf("  mov rax, rdx\n");
+    }
+}
+
+// Order of case values as the controlling type.
+static bool case_value_less(unsigned long a, unsigned long b, bool is_signed) {
+    if(!is_signed) {
+        a = a ^ (1UL << 63);
+        b = b ^ (1UL << 63);
+    }
+    return (long)a < (long)b;
+}
+
+static void gen_cmp_rax_const(unsigned long val) {
+    if(is_imm32(val)) {
+        printf("  cmp rax, %ld\n", (long)val);
+    }else {
+        printf("  mov rsi, %lu\n", val);
+        printf("  cmp rax, rsi\n");
+    }
+}
+
+// Sorted case values of a switch statement. labels holds the raw values which name the case labels.
+struct SwitchCases {
+    int cur;
+    unsigned long *values;
+    unsigned long *labels;
+    bool is_signed;
+    char *default_label;
+};
+
+static void gen_switch_search(SwitchCases *cases, int lo, int hi) {
+    int cur = cases->cur;
+    if(hi - lo < 4) {
+        for(int i = lo; i < hi; i++) {
+            gen_cmp_rax_const(cases->values[i]);
+            printf("  je .Lswitch_%d_%lu\n", cur, cases->labels[i]);
+        }
+        printf("  jmp .Lswitch_%d_%s\n", cur, cases->default_label);
+        return;
+    }
+    int mid = (lo + hi) / 2;
+    int label = ++cur_label;
+    gen_cmp_rax_const(cases->values[mid]);
+    printf("  je .Lswitch_%d_%lu\n", cur, cases->labels[mid]);
+    printf("  %s .Lswitch_%d_lower_%d\n", cases->is_signed ? "jl" : "jb", cur, label);
+    gen_switch_search(cases, mid + 1, hi);
+    printf(".Lswitch_%d_lower_%d:\n", cur, label);
+    gen_switch_search(cases, lo, mid);
+}
+
+// Jumps to the case label for the value in rax.
+// Dense case sets use a jump table, sparse ones a binary search, and tiny ones a compare chain.
+static void gen_switch_dispatch(Node *node, int cur) {
+    Type *type = node->lhs->expr_type;
+    int size = type_sizeof(type);
+    bool is_signed = type_is_signed(type) || size < 4;
+    char *default_label = node->switch_.default_stmt ? "default" : "end";
+
+    // Extend the condition to 64 bits. Case values are converted to the promoted type.
+    if(size == 1) {
+        printf("  %s\n", type_is_signed(type) ? "movsx rax, al" : "movzx eax, al");
+    }else if(size == 2) {
+        printf("  %s\n", type_is_signed(type) ? "movsx rax, ax" : "movzx eax, ax");
+    }else if(size == 4) {
+        printf("  %s\n", is_signed ? "movsx rax, eax" : "mov eax, eax");
+    }
+
+    int n = vector_size(node->switch_.cases);
+    unsigned long *values = calloc(n + 1, sizeof(unsigned long));
+    unsigned long *labels = calloc(n + 1, sizeof(unsigned long));
+    unsigned long total = node->switch_.default_stmt ? profile_count(node->switch_.default_stmt) : 0;
+    Node *hot_case = NULL;
+    unsigned long hot_value = 0;
+    for(int i = 0; i < n; i++) {
+        Node *case_node = vector_get(node->switch_.cases, i);
+        unsigned long v = normalize_value(case_node->rhs->val, size < 4 ? 4 : size, is_signed);
+        total += profile_count(case_node);
+        if(!hot_case || profile_count(hot_case) < profile_count(case_node)) {
+            hot_case = case_node;
+            hot_value = v;
+        }
+        int j = i;
+        while(j > 0 && case_value_less(v, values[j - 1], is_signed)) {
+            values[j] = values[j - 1];
+            labels[j] = labels[j - 1];
+            j--;
+        }
+        values[j] = v;
+        labels[j] = case_node->rhs->val;
+    }
+
+    // With -fprofile-use, a case taking most of the executions is tested before the search or the jump table.
+    if(hot_case && profile_count(hot_case) * 2 > total) {
+        if(is_imm32(hot_value)) {
+            printf("  cmp rax, %ld\n", (long)hot_value);
+        }else {
+            printf("  mov rsi, %lu\n", hot_value);
+            printf("  cmp rax, rsi\n");
+        }
+        printf("  je .Lswitch_%d_%lu\n", cur, hot_case->rhs->val);
+    }
+
+    unsigned long range = 0;
+    if(n > 0) {
+        range = values[n - 1] - values[0];
+    }
+    if(n < 4 || case_value_less(3UL * n, range, false) || case_value_less(switch_table_max, range, false)) {
+        SwitchCases *cases = calloc(1, sizeof(SwitchCases));
+        cases->cur = cur;
+        cases->values = values;
+        cases->labels = labels;
+        cases->is_signed = is_signed;
+        cases->default_label = default_label;
+        gen_switch_search(cases, 0, n);
+        return;
+    }
+
+    printf("  // jump table\n");
+    if(values[0] != 0) {
+        if(is_imm32(values[0])) {
+            printf("  sub rax, %ld\n", (long)values[0]);
+        }else {
+            printf("  mov rsi, %lu\n", values[0]);
+            printf("  sub rax, rsi\n");
+        }
+    }
+    printf("  cmp rax, %lu\n", range);
+    printf("  ja .Lswitch_%d_%s\n", cur, default_label);
+    printf("  lea rsi, [rip + .Lswitch_%d_table]\n", cur);
+    printf("  movsxd rax, dword ptr [rsi+rax*4]\n");
+    printf("  add rax, rsi\n");
+    printf("  jmp rax\n");
+    printf("  .pushsection .rodata\n");
+    printf("  .p2align 2\n");
+    printf(".Lswitch_%d_table:\n", cur);
+    int index = 0;
+    for(unsigned long offset = 0; offset <= range; offset++) {
+        if(values[index] - values[0] == offset) {
+            printf("  .long .Lswitch_%d_%lu - .Lswitch_%d_table\n", cur, labels[index], cur);
+            index++;
+        }else {
+            printf("  .long .Lswitch_%d_%s - .Lswitch_%d_table\n", cur, default_label, cur);
+        }
+    }
+    printf("  .popsection\n");
+}
+
+static bool is_compare(NodeKind kind) {
+    return kind == ND_EQUAL || kind == ND_NOT_EQUAL || kind == ND_LESS || kind == ND_LESS_OR_EQUAL
+        || kind == ND_GREATER || kind == ND_GREATER_OR_EQUAL;
+}
+
+static NodeKind negate_compare(NodeKind kind) {
+    switch(kind) {
+        case ND_EQUAL: return ND_NOT_EQUAL;
+        case ND_NOT_EQUAL: return ND_EQUAL;
+        case ND_LESS: return ND_GREATER_OR_EQUAL;
+        case ND_LESS_OR_EQUAL: return ND_GREATER;
+        case ND_GREATER: return ND_LESS_OR_EQUAL;
+        case ND_GREATER_OR_EQUAL: return ND_LESS;
+    }
+    error("Not a comparison: %s", node_kind(kind));
+    return kind;
+}
+
+// Condition code suffix (for jcc/setcc) which is true when comparison kind holds.
+static char *compare_cc(NodeKind kind, bool is_signed) {
+    switch(kind) {
+        case ND_EQUAL: return "e";
+        case ND_NOT_EQUAL: return "ne";
+        case ND_LESS: return is_signed ? "l" : "b";
+        case ND_LESS_OR_EQUAL: return is_signed ? "le" : "be";
+        case ND_GREATER: return is_signed ? "g" : "a";
+        case ND_GREATER_OR_EQUAL: return is_signed ? "ge" : "ae";
+    }
+    error("Not a comparison: %s", node_kind(kind));
+    return NULL;
+}
+
+// Evaluates operands of a comparison and sets flags by cmp.
+// Returns whether operands are compared as signed integers.
+static bool gen_compare(Node *node) {
+    Type *type = node->lhs->expr_type;
+    bool is_signed = type_is_int(type) && type_is_signed(type);
+    // 32-bit operands may have garbage in upper bits
+    bool is_32bit = type_sizeof(type) == 4 && node->rhs->expr_type && type_sizeof(node->rhs->expr_type) == 4;
+    char *rax = is_32bit ? "eax" : "rax";
+    unsigned long val;
+    gen(node->lhs);
+    if(get_const_value(node->rhs, &val) && is_imm32(val)) {
+        gen_pop("rax");
+        if(val == 0 && (node->kind == ND_EQUAL || node->kind == ND_NOT_EQUAL)) {
+            printf("  test %s, %s\n", rax, rax);
+        }else {
+            printf("  cmp %s, %ld\n", rax, (long)val);
+        }
+    }else {
+        gen(node->rhs);
+        gen_pop("rsi");
+        gen_pop("rax");
+        printf("  cmp %s, %s\n", rax, is_32bit ? "esi" : "rsi");
+    }
+    return is_signed;
+}
+
+// Jumps to .L<label> if truth value of cond equals jump_if, otherwise falls through.
+// Comparisons branch on flags directly, and &&, || and ?: (ND_IF expressions) are short-circuited.
+static void gen_cond_jump(Node *cond, bool jump_if, int label) {
+    unsigned long val;
+    Node *exp;
+    if(builtin_expect_operand(cond, &exp, &val)) {
+        gen_cond_jump(exp, jump_if, label);
+        return;
+    }
+    if(get_const_value(cond, &val)) {
+        if((val != 0) == jump_if) {
+            printf("  jmp .L%d\n", label);
+        }
+        return;
+    }
+    if((cond->kind == ND_EQUAL || cond->kind == ND_NOT_EQUAL) && get_const_value(cond->rhs, &val) && val == 0
+            && (is_compare(cond->lhs->kind) || cond->lhs->kind == ND_IF)) {
+        // !x
+        gen_cond_jump(cond->lhs, cond->kind == ND_EQUAL ? !jump_if : jump_if, label);
+        return;
+    }
+    if(is_compare(cond->kind)) {
+        bool is_signed = gen_compare(cond);
+        NodeKind kind = jump_if ? cond->kind : negate_compare(cond->kind);
+        printf("  j%s .L%d\n", compare_cc(kind, is_signed), label);
+        return;
+    }
+    if(cond->kind == ND_IF && cond->else_stmt) {
+        // cond->lhs ? cond->rhs : cond->else_stmt
+        if(get_const_value(cond->else_stmt, &val) && (val != 0) == jump_if) {
+            gen_cond_jump(cond->lhs, false, label);
+            gen_cond_jump(cond->rhs, jump_if, label);
+            return;
+        }
+        int label_else = ++cur_label;
+        int label_end = ++cur_label;
+        gen_cond_jump(cond->lhs, false, label_else);
+        gen_cond_jump(cond->rhs, jump_if, label);
+        printf("  jmp .L%d\n", label_end);
+        printf(".L%d:\n", label_else);
+        gen_cond_jump(cond->else_stmt, jump_if, label);
+        printf(".L%d:\n", label_end);
+        return;
+    }
+    gen(cond);
+    gen_pop("rax");
+    if(cond->expr_type && type_sizeof(cond->expr_type) == 4) {
+        printf("  test eax, eax\n");
+    }else {
+        printf("  test rax, rax\n");
+    }
+    printf("  %s .L%d\n", jump_if ? "jnz" : "jz", label);
+}
+
+/// Cold blocks ///
+
+// A rarely executed branch, generated after the function in .text.unlikely.
+// The state of the code generator at the branch is kept to generate it there.
+struct ColdBlock {
+    Node *stmt;
+    Node *if_node; // counts the branch with its counter_slot-th counter
+    int counter_slot;
+    int label;
+    int label_end;
+    int stack_depth;
+    bool cfa_on_rsp;
+    Vector *break_targets;
+    Vector *continue_targets;
+    Vector *switch_numbers;
+    Vector *inline_returns;
+};
+
+Vector *cold_blocks;
+// Generating cold blocks. Loops there are not aligned.
+bool in_cold_code = false;
+
+// Defers stmt, which is jumped to at label and jumps to label_end after pushing its value.
+static void defer_cold_block(Node *if_node, bool then_branch, int label, int label_end) {
+    ColdBlock *block = calloc(1, sizeof(ColdBlock));
+    block->stmt = then_branch ? if_node->rhs : if_node->else_stmt;
+    block->if_node = if_node;
+    block->counter_slot = then_branch ? 0 : 1;
+    block->label = label;
+    block->label_end = label_end;
+    block->stack_depth = stack_depth;
+    block->cfa_on_rsp = cfa_on_rsp;
+    block->break_targets = vector_dup(break_target_vec);
+    block->continue_targets = vector_dup(continue_target_vec);
+    block->switch_numbers = vector_dup(switch_number_vec);
+    block->inline_returns = vector_dup(inline_return_vec);
+    vector_push(cold_blocks, block);
+}
+
+// Emits the cold blocks of func as func.cold, which has its own unwind information like gcc's.
+// Cold blocks inside cold blocks are appended while generating.
+static void gen_cold_blocks(Node *func) {
+    if(vector_size(cold_blocks) == 0) {
+        return;
+    }
+    char *name = func->func_def.ident;
+    int len = func->func_def.ident_len;
+    printf(".section .text.unlikely,\"ax\",@progbits\n");
+    printf(".type %.*s.cold, @function\n", len, name);
+    printf("%.*s.cold:\n", len, name);
+    printf("  .cfi_startproc\n");
+    int pushed = 1;
+    if(func->func_def.uses_frame) {
+        printf("  .cfi_offset rbp, -%d\n", ++pushed * 8);
+    }
+    for(int i = 0; i < vector_size(saved_regs); i++) {
+        printf("  .cfi_offset %s, -%d\n", (char*)vector_get(saved_regs, i), ++pushed * 8);
+    }
+    Vector *break_targets = break_target_vec;
+    Vector *continue_targets = continue_target_vec;
+    Vector *switch_numbers = switch_number_vec;
+    Vector *inline_returns = inline_return_vec;
+    in_cold_code = true;
+    for(int i = 0; i < vector_size(cold_blocks); i++) {
+        ColdBlock *block = vector_get(cold_blocks, i);
+        stack_depth = block->stack_depth;
+        cfa_on_rsp = block->cfa_on_rsp;
+        break_target_vec = block->break_targets;
+        continue_target_vec = block->continue_targets;
+        switch_number_vec = block->switch_numbers;
+        inline_return_vec = block->inline_returns;
+        if(cfa_on_rsp) {
+            printf("  .cfi_def_cfa rsp, %d\n", stack_depth);
+        }else {
+            printf("  .cfi_def_cfa rbp, %d\n", frame_cfa_offset);
+        }
+        printf(".L%d:\n", block->label);
+        gen_profile_counter(block->if_node, block->counter_slot);
+        gen(block->stmt);
+        printf("  jmp .L%d\n", block->label_end);
+    }
+    in_cold_code = false;
+    break_target_vec = break_targets;
+    continue_target_vec = continue_targets;
+    switch_number_vec = switch_numbers;
+    inline_return_vec = inline_returns;
+    cfa_on_rsp = false;
+    printf("  .cfi_endproc\n");
+    printf(".size %.*s.cold, .-%.*s.cold\n", len, name, len, name);
+    cold_blocks = new_vector();
+}
+
+// Aligns the header of a hot loop like gcc, skipping at most 10 bytes of padding.
+static void gen_loop_align(Node *loop) {
+    if(!in_cold_code && loop_is_hot(loop)) {
+        printf("  .p2align 4,,10\n");
+    }
+}
+
+/// Vector loop ///
+
+static const char *vector_base_regs[] = {"rdi", "rsi", "r8", "r9", "r10", "r11"};
+// Vector registers with fixed roles. Element-wise expressions use registers from 0.
+static const int vreg_scalar = 15; // broadcast scalars, counting down
+static const int vreg_acc = 11;
+static const int vreg_tmp = 10;
+static const int vreg_hsum = 9;
+
+static char *vreg_prefix() {
+    return opt_avx2 ? "ymm" : "xmm";
+}
+
+static char size_suffix(int size) {
+    if(size == 1) return 'b';
+    if(size == 2) return 'w';
+    if(size == 4) return 'd';
+    return 'q';
+}
+
+// dst = dst op src
+static void gen_vop(char *op, int dst, int src) {
+    if(opt_avx2) {
+        printf("  v%s ymm%d, ymm%d, ymm%d\n", op, dst, dst, src);
+    }else {
+        printf("  %s xmm%d, xmm%d\n", op, dst, src);
+    }
+}
+
+static void gen_vop_sized(char *op, int size, int dst, int src) {
+    char buf[16];
+    sprintf(buf, "%s%c", op, size_suffix(size));
+    gen_vop(buf, dst, src);
+}
+
+static void gen_vmov(int dst, int src) {
+    printf("  %s %s%d, %s%d\n", opt_avx2 ? "vmovdqa" : "movdqa", vreg_prefix(), dst, vreg_prefix(), src);
+}
+
+// Fills all lanes of vector register reg with the low size bytes of rax.
+static void gen_vbroadcast(int reg, int size) {
+    if(opt_avx2) {
+        printf("  vmovq xmm%d, rax\n", reg);
+        printf("  vpbroadcast%c ymm%d, xmm%d\n", size_suffix(size), reg, reg);
+        return;
+    }
+    printf("  movq xmm%d, rax\n", reg);
+    if(size == 1) {
+        printf("  punpcklbw xmm%d, xmm%d\n", reg, reg);
+    }
+    if(size <= 2) {
+        printf("  punpcklwd xmm%d, xmm%d\n", reg, reg);
+    }
+    if(size <= 4) {
+        printf("  pshufd xmm%d, xmm%d, 0\n", reg, reg);
+    }else {
+        printf("  punpcklqdq xmm%d, xmm%d\n", reg, reg);
+    }
+}
+
+// dst = min/max(dst, src) on signed 32-bit lanes. src is clobbered.
+static void gen_vminmax(int dst, int src, bool is_max) {
+    if(opt_avx2) {
+        gen_vop(is_max ? "pmaxsd" : "pminsd", dst, src);
+        return;
+    }
+    // SSE2 has no pmaxsd: select by mask of pcmpgtd
+    if(is_max) {
+        printf("  movdqa xmm%d, xmm%d\n", vreg_tmp, src);
+        printf("  pcmpgtd xmm%d, xmm%d\n", vreg_tmp, dst);
+    }else {
+        printf("  movdqa xmm%d, xmm%d\n", vreg_tmp, dst);
+        printf("  pcmpgtd xmm%d, xmm%d\n", vreg_tmp, src);
+    }
+    printf("  pand xmm%d, xmm%d\n", src, vreg_tmp);
+    printf("  pandn xmm%d, xmm%d\n", vreg_tmp, dst);
+    printf("  por xmm%d, xmm%d\n", src, vreg_tmp);
+    printf("  movdqa xmm%d, xmm%d\n", dst, src);
+}
+
+static void collect_vector_operands(Node *node, Vector *operands) {
+    if(node->kind == ND_VECTOR_OPERAND) {
+        vector_push(operands, node);
+        return;
+    }
+    collect_vector_operands(node->lhs, operands);
+    if(node->rhs) {
+        collect_vector_operands(node->rhs, operands);
+    }
+}
+
+// Evaluates element-wise expression into vector register reg. Loop counter is in rcx.
+static void gen_vexpr(Node *node, int reg, int elem_size) {
+    switch(node->kind) {
+        case ND_VECTOR_OPERAND:
+            if(node->vector_operand.is_load) {
+                printf("  %s %s%d, [%s+rcx*%d]\n", opt_avx2 ? "vmovdqu" : "movdqu", vreg_prefix(), reg,
+                        vector_base_regs[node->vector_operand.reg], elem_size);
+            }else {
+                gen_vmov(reg, node->vector_operand.reg);
+            }
+            return;
+        case ND_BIT_NOT:
+            gen_vexpr(node->lhs, reg, elem_size);
+            gen_vop("pcmpeqd", reg + 1, reg + 1);
+            gen_vop("pxor", reg, reg + 1);
+            return;
+    }
+    gen_vexpr(node->lhs, reg, elem_size);
+    gen_vexpr(node->rhs, reg + 1, elem_size);
+    switch(node->kind) {
+        case ND_ADD: gen_vop_sized("padd", elem_size, reg, reg + 1); break;
+        case ND_SUB: gen_vop_sized("psub", elem_size, reg, reg + 1); break;
+        case ND_AND: gen_vop("pand", reg, reg + 1); break;
+        case ND_OR: gen_vop("por", reg, reg + 1); break;
+        case ND_XOR: gen_vop("pxor", reg, reg + 1); break;
+        default:
+            error("Unsupported vector operation %s", node_kind(node->kind));
+    }
+}
+
+// Reduces lanes of the accumulator into rsi.
+static void gen_vector_reduction(VectorLoop *vl) {
+    bool is_minmax = vl->kind == VL_MIN || vl->kind == VL_MAX;
+    int size = vl->kind == VL_SUM_BYTES ? 8 : vl->elem_size;
+    if(opt_avx2) {
+        printf("  vextracti128 xmm%d, ymm%d, 1\n", vreg_hsum, vreg_acc);
+        if(is_minmax) {
+            printf("  vp%ssd xmm%d, xmm%d, xmm%d\n", vl->kind == VL_MAX ? "max" : "min", vreg_acc, vreg_acc, vreg_hsum);
+        }else {
+            printf("  vpadd%c xmm%d, xmm%d, xmm%d\n", size_suffix(size), vreg_acc, vreg_acc, vreg_hsum);
+        }
+        // Upper halves are no longer used. Remaining steps use legacy SSE encoding.
+        printf("  vzeroupper\n");
+    }
+    bool avx2 = opt_avx2;
+    opt_avx2 = false;
+    printf("  pshufd xmm%d, xmm%d, 0x4e\n", vreg_hsum, vreg_acc);
+    if(is_minmax) {
+        gen_vminmax(vreg_acc, vreg_hsum, vl->kind == VL_MAX);
+    }else {
+        gen_vop_sized("padd", size, vreg_acc, vreg_hsum);
+    }
+    if(size == 4) {
+        printf("  pshufd xmm%d, xmm%d, 0xb1\n", vreg_hsum, vreg_acc);
+        if(is_minmax) {
+            gen_vminmax(vreg_acc, vreg_hsum, vl->kind == VL_MAX);
+        }else {
+            gen_vop_sized("padd", size, vreg_acc, vreg_hsum);
+        }
+    }
+    opt_avx2 = avx2;
+    printf("  movq rsi, xmm%d\n", vreg_acc);
+}
+
+// Runs the vector loop while at least one full vector of iterations remains,
+// then falls into the original loop for the rest.
+static void gen_vector_loop(Node *node) {
+    VectorLoop *vl = node->vector_loop;
+    int width = opt_avx2 ? 32 : 16;
+    int lanes = width / vl->elem_size;
+    int label = ++cur_label;
+    printf("  // vector loop %d (%s, %d lanes)\n", label, opt_avx2 ? "avx2" : "sse2", lanes);
+    if(node->lhs) {
+        gen(node->lhs);
+        gen_pop("rax");
+    }
+
+    Vector *operands = new_vector();
+    collect_vector_operands(vl->expr, operands);
+    int base_regs = vl->dest ? 1 : 0;
+    int scalar_regs = 0;
+    for(int i = 0; i < vector_size(operands); i++) {
+        Node *operand = vector_get(operands, i);
+        if(operand->vector_operand.is_load) {
+            operand->vector_operand.reg = base_regs++;
+        }else {
+            operand->vector_operand.reg = vreg_scalar - scalar_regs++;
+        }
+    }
+
+    // Evaluate loop invariants, then move them to registers
+    gen(vl->bound);
+    if(vl->dest) {
+        gen(vl->dest);
+    }
+    for(int i = 0; i < vector_size(operands); i++) {
+        Node *operand = vector_get(operands, i);
+        gen(operand->lhs);
+    }
+    gen(vl->iv);
+    if(vl->kind == VL_MIN || vl->kind == VL_MAX) {
+        gen(vl->acc);
+        gen_pop("rax");
+        gen_vbroadcast(vreg_acc, 4);
+    }
+    gen_pop("rcx");
+    for(int i = vector_size(operands) - 1; i >= 0; i--) {
+        Node *operand = vector_get(operands, i);
+        if(operand->vector_operand.is_load) {
+            gen_pop((char*)vector_base_regs[operand->vector_operand.reg]);
+        }else {
+            gen_pop("rax");
+            gen_vbroadcast(operand->vector_operand.reg, vl->elem_size);
+        }
+    }
+    if(vl->dest) {
+        gen_pop((char*)vector_base_regs[0]);
+    }
+    gen_pop("rdx");
+    if(type_sizeof(vl->bound->expr_type) == 4) {
+        printf("  movsx rdx, edx\n");
+    }
+    if(vl->kind == VL_SUM || vl->kind == VL_SUM_BYTES) {
+        gen_vop("pxor", vreg_acc, vreg_acc);
+    }
+    if(vl->kind == VL_SUM_BYTES) {
+        gen_vop("pxor", vreg_tmp, vreg_tmp);
+    }
+    if(vl->kind == VL_MAP) {
+        // Partially overlapping source behind the destination carries values between iterations.
+        for(int i = 0; i < vector_size(operands); i++) {
+            Node *operand = vector_get(operands, i);
+            if(!operand->vector_operand.is_load) {
+                continue;
+            }
+            printf("  mov rax, %s\n", vector_base_regs[0]);
+            printf("  sub rax, %s\n", vector_base_regs[operand->vector_operand.reg]);
+            printf("  dec rax\n");
+            printf("  cmp rax, %d\n", width - 2);
+            printf("  jbe .Lvector_end_%d\n", label);
+        }
+    }
+
+    printf("  lea rax, [rcx+%d]\n", lanes);
+    printf("  cmp rax, rdx\n");
+    printf("  jg .Lvector_end_%d\n", label);
+    printf(".Lvector_loop_%d:\n", label);
+    switch(vl->kind) {
+        case VL_MAP:
+            gen_vexpr(vl->expr, 0, vl->elem_size);
+            printf("  %s [%s+rcx*%d], %s0\n", opt_avx2 ? "vmovdqu" : "movdqu", vector_base_regs[0], vl->elem_size, vreg_prefix());
+            break;
+        case VL_SUM:
+            gen_vexpr(vl->expr, 0, vl->elem_size);
+            gen_vop_sized("padd", vl->elem_size, vreg_acc, 0);
+            break;
+        case VL_SUM_BYTES:
+            gen_vexpr(vl->expr, 0, vl->elem_size);
+            gen_vop("psadbw", 0, vreg_tmp);
+            gen_vop("paddq", vreg_acc, 0);
+            break;
+        case VL_MIN:
+        case VL_MAX:
+            gen_vexpr(vl->expr, 0, vl->elem_size);
+            gen_vminmax(vreg_acc, 0, vl->kind == VL_MAX);
+            break;
+    }
+    printf("  add rcx, %d\n", lanes);
+    printf("  lea rax, [rcx+%d]\n", lanes);
+    printf("  cmp rax, rdx\n");
+    printf("  jle .Lvector_loop_%d\n", label);
+    printf(".Lvector_end_%d:\n", label);
+
+    if(vl->kind != VL_MAP) {
+        gen_vector_reduction(vl);
+    }else if(opt_avx2) {
+        printf("  vzeroupper\n");
+    }
+    // Write back the loop counter and the reduction
+    if(is_reg_var(vl->iv)) {
+        printf("  mov rax, rcx\n");
+        gen_store_reg_var(vl->iv->lvar);
+    }else {
+        gen_lvar(vl->iv);
+        gen_pop("rax");
+        printf("  mov %s [rax], %s\n", access_size(type_sizeof(vl->iv->expr_type)), type_sizeof(vl->iv->expr_type) == 4 ? "ecx" : "rcx");
+    }
+    if(vl->acc && is_reg_var(vl->acc)) {
+        printf("  mov rax, rsi\n");
+        if(vl->kind == VL_SUM || vl->kind == VL_SUM_BYTES) {
+            printf("  add rax, %s\n", reg_vars[vl->acc->lvar->reg - 1]);
+        }
+        gen_store_reg_var(vl->acc->lvar);
+    }else if(vl->acc) {
+        gen_lvar(vl->acc);
+        gen_pop("rax");
+        int size = type_sizeof(vl->acc->expr_type);
+        printf("  %s %s [rax], %s\n", vl->kind == VL_SUM || vl->kind == VL_SUM_BYTES ? "add" : "mov",
+                access_size(size), size == 4 ? "esi" : "rsi");
+    }
+    gen(node->rhs);
+}
+
 void gen(Node *node){
     if(node->line_info) {
         bool found = false;
@@ -212,14 +1635,18 @@ void gen(Node *node){
     switch(node->kind){
         case ND_NUM:
             printf("  mov rax, %lu\n", node->val);
-            printf("  push rax\n");
+            gen_push("rax");
             return;
         case ND_STRING_LITERAL:
-            printf("  lea rax, .L_S_%d[rip]\n", node->string_literal.literal->index);
-            printf("  push rax\n");
+            printf("  lea rax, .L_S_%d[rip]\n", string_literal_label(node->string_literal.literal));
+            gen_push("rax");
             return;
         case ND_LVAR: // fall through
         case ND_GVAR:
+            if(is_reg_var(node)) {
+                gen_push((char*)reg_vars[node->lvar->reg - 1]);
+                return;
+            }
             gen_lvar(node);
             if(node->expr_type->ty != ARRAY) {
                 load(type_sizeof(node->expr_type));
@@ -234,126 +1661,212 @@ void gen(Node *node){
             return;
         case ND_BIT_NOT:
             gen(node->lhs);
-            printf("  pop rax\n");
+            gen_pop("rax");
             printf("  not rax\n");
-            printf("  push rax\n");
+            gen_push("rax");
             return;
         case ND_POSTFIX_INC:
-        case ND_POSTFIX_DEC:
-            gen_lvar(node->lhs);
-            printf("  pop rax\n");
-            printf("  mov rsi, rax\n");
-            printf("  push rax\n");
-            load(type_sizeof(node->expr_type));
-            printf("  pop rax\n");
-            printf("  mov rcx, rax\n");
-            printf("  add rax, %ld\n", node->incdec.value);
-            printf("  push rsi\n");
-            printf("  push rax\n");
-            store(type_sizeof(node->expr_type));
-            printf("  pop rax\n");
-            printf("  push rcx\n");
+        case ND_POSTFIX_DEC: {
+            if(is_reg_var(node->lhs)) {
+                printf("  mov rax, %s\n", reg_vars[node->lhs->lvar->reg - 1]);
+                gen_push("rax");
+                printf("  add rax, %ld\n", node->incdec.value);
+                gen_store_reg_var(node->lhs->lvar);
+                return;
+            }
+            // The old value is loaded once and the variable is updated in memory.
+            char addr[64];
+            gen_incdec_operand(node, addr);
+            gen_load_to("rax", addr, type_sizeof(node->expr_type));
+            gen_incdec_memory(node, addr);
+            gen_push("rax");
             return;
+        }
         case ND_PREFIX_INC:
-        case ND_PREFIX_DEC:
-            gen_lvar(node->lhs);
-            printf("  pop rax\n");
-            printf("  mov rsi, rax\n");
-            printf("  push rax\n");
-            load(type_sizeof(node->expr_type));
-            printf("  pop rax\n");
-            printf("  add rax, %ld\n", node->incdec.value);
-            printf("  mov rcx, rax\n");
-            printf("  push rsi\n");
-            printf("  push rax\n");
-            store(type_sizeof(node->expr_type));
-            printf("  pop rax\n");
-            printf("  push rcx\n");
+        case ND_PREFIX_DEC: {
+            if(is_reg_var(node->lhs)) {
+                printf("  mov rax, %s\n", reg_vars[node->lhs->lvar->reg - 1]);
+                printf("  add rax, %ld\n", node->incdec.value);
+                gen_store_reg_var(node->lhs->lvar);
+                gen_push("rax");
+                return;
+            }
+            char addr[64];
+            gen_incdec_operand(node, addr);
+            gen_incdec_memory(node, addr);
+            gen_load_to("rax", addr, type_sizeof(node->expr_type));
+            gen_push("rax");
             return;
+        }
         case ND_ASSIGN:
+            if(is_reg_var(node->lhs)) {
+                gen(node->rhs);
+                gen_pop("rax");
+                gen_store_reg_var(node->lhs->lvar);
+                gen_push("rax");
+                return;
+            }
             gen_lvar(node->lhs);
             gen(node->rhs);
+            if(is_aggregate_value(node->lhs->expr_type)) {
+                gen_pop("rsi");
+                gen_pop("rdi");
+                gen_push("rdi");
+                gen_copy(type_sizeof(node->lhs->expr_type));
+                return;
+            }
 
             store(type_sizeof(node->lhs->expr_type));
             return;
-        case ND_RETURN:
+        case ND_RETURN: {
+            // Code after return is unreachable. Keep the depth as if it pushed a value like other statements.
+            int depth = stack_depth;
+            if(node->lhs && node->lhs->kind == ND_CALL && node->lhs->is_tail_call) {
+                gen_profile_counter(node->lhs, 0);
+                gen_tail_call(node->lhs);
+                stack_depth = depth + 8;
+                gen_cfa();
+                return;
+            }
             if(node->lhs) {
                 gen(node->lhs);
             }else {
-                printf("  push 0\n");
+                gen_push("0");
+            }
+            if(vector_size(inline_return_vec)) {
+                // return from inlined function body
+                gen_pop("rax");
+                printf("  jmp .Linline_ret_%d\n", (int)(long)vector_last(inline_return_vec));
+                stack_depth = depth + 8;
+                gen_cfa();
+                return;
             }
             gen_return();
+            stack_depth = depth + 8;
+            gen_cfa();
             return;
+        }
         case ND_IF: {
             // if statement pushes value of executed statement.
             printf("  # if cond\n");
-            gen(node->lhs);
-            printf("  pop rax\n");
-            printf("  test rax,rax\n");
+            int depth = stack_depth;
             int label = ++cur_label;
-            printf("  jz .L%d\n", label);
+            int label_skip_else = ++cur_label;
+            bool then_is_cold = branch_is_cold(node, true);
+            if(then_is_cold || branch_is_cold(node, false)) {
+                // Only the likely branch stays here. The other is jumped to in func.cold.
+                Node *likely = then_is_cold ? node->else_stmt : node->rhs;
+                gen_cond_jump(node->lhs, then_is_cold, label);
+                defer_cold_block(node, then_is_cold, label, label_skip_else);
+                if(then_is_cold) {
+                    printf("  # else%s\n", likely ? "" : " empty");
+                }else {
+                    printf("  # if stmt\n");
+                }
+                gen_profile_counter(node, then_is_cold ? 1 : 0);
+                if(likely) {
+                    gen(likely);
+                }else {
+                    gen_push("0");
+                }
+                printf(".L%d:\n", label_skip_else);
+                printf("  # if end\n");
+                stack_depth = depth + 8;
+                gen_cfa();
+                return;
+            }
+            if(profile_else_is_likely(node)) {
+                // The else branch falls through and the then branch is placed after it.
+                gen_cond_jump(node->lhs, true, label);
+                printf("  # else%s\n", node->else_stmt ? "" : " empty");
+                gen_profile_counter(node, 1);
+                if(node->else_stmt) {
+                    gen(node->else_stmt);
+                }else{
+                    printf("  # dummy else statement\n");
+                    gen_push("0");
+                }
+                printf("  jmp .L%d\n", label_skip_else);
+                printf(".L%d:\n", label);
+                stack_depth = depth;
+                gen_cfa();
+                printf("  # if stmt\n");
+                gen_profile_counter(node, 0);
+                gen(node->rhs);
+                printf(".L%d:\n", label_skip_else);
+                printf("  # if end\n");
+                stack_depth = depth + 8;
+                gen_cfa();
+                return;
+            }
+            gen_cond_jump(node->lhs, false, label);
             printf("  # if stmt\n");
+            gen_profile_counter(node, 0);
             gen(node->rhs);
 
             printf("  # else%s\n", node->else_stmt ? "" : " empty");
-            int label_skip_else = ++cur_label;
             printf("  jmp .L%d\n", label_skip_else);
             printf(".L%d:\n", label);
+            stack_depth = depth;
+            gen_cfa();
+            gen_profile_counter(node, 1);
             if(node->else_stmt) {
                 gen(node->else_stmt);
             }else{
-                printf("  push 0  # dummy else statement\n");
+                printf("  # dummy else statement\n");
+                gen_push("0");
             }
             printf(".L%d:\n", label_skip_else);
             printf("  # if end\n");
+            stack_depth = depth + 8;
+            gen_cfa();
             return;
         }
         case ND_SWITCH: {
             // TODO: Check stack position for jump target?
             // condition expression
             int cur = ++switch_number;
+            vector_push(switch_number_vec, (void*)(long)cur);
             int break_target = ++current_break_target;
             vector_push(break_target_vec, (void*)(long)break_target);
             printf("  // switch %d\n", cur);
             gen(node->lhs);
-            printf("  pop rax\n");
-            for(int i = 0; i < vector_size(node->switch_.cases); i++){
-                Node *case_node = vector_get(node->switch_.cases, i);
-                int64_t v = case_node->rhs->val;
-                printf("  cmp rax, %lu\n", v);
-                printf("  jz .Lswitch_%d_%lu\n", cur, v);
-            }
-            if(node->switch_.default_stmt) {
-                printf("  jmp .Lswitch_%d_default\n", cur);
-            }else {
-                printf("  jmp .Lswitch_%d_end\n", cur);
-            }
+            gen_pop("rax");
+            gen_switch_dispatch(node, cur);
             gen(node->rhs);
-            printf("  pop rax\n");
+            gen_pop("rax");
             printf("  .Lswitch_%d_end:\n", cur);
             printf("  .Lbreak_%d:\n", break_target);
-            printf("  push rax\n");
+            gen_push("rax");
 
             vector_pop(break_target_vec);
+            vector_pop(switch_number_vec);
 
             return;
         }
         case ND_CASE: {
-            printf("  .Lswitch_%d_%lu:\n", switch_number, node->rhs->val);
+            printf("  .Lswitch_%d_%lu:\n", (int)(long)vector_last(switch_number_vec), node->rhs->val);
+            gen_profile_counter(node, 0);
             gen(node->lhs);
             return;
         }
         case ND_DEFAULT: {
-            printf("  .Lswitch_%d_default:\n", switch_number);
+            printf("  .Lswitch_%d_default:\n", (int)(long)vector_last(switch_number_vec));
+            gen_profile_counter(node, 0);
             gen(node->lhs);
             return;
         }
         case ND_BREAK: {
             printf("  jmp .Lbreak_%d\n", (int)(long)vector_last(break_target_vec));
+            // The enclosing statement list pops the value of unreachable code.
+            stack_depth += 8;
+            gen_cfa();
             return;
         }
         case ND_CONTINUE: {
             printf("  jmp .Lcontinue_%d\n", (int)(long)vector_last(continue_target_vec));
+            stack_depth += 8;
+            gen_cfa();
             return;
         }
         case ND_FOR: {
@@ -364,33 +1877,34 @@ void gen(Node *node){
             // clause-1
             if(node->lhs) {
                 gen(node->lhs);
-                printf("  pop rax\n");
+                gen_pop("rax");
             }
+            // condition is placed after the body, so that each iteration takes one branch.
             int label_for = ++cur_label;
+            int label_cond = ++cur_label;
+            gen_profile_counter(node, 1);
+            printf("  jmp .L%d\n", label_cond);
+            gen_loop_align(node);
             printf(".L%d:\n", label_for);
-            // condition
-            if(node->rhs) {
-                gen(node->rhs);
-                printf("  pop rax\n");
-            } else {
-                printf("  mov rax, 1\n");
-            }
-            printf("  test rax,rax\n");
-            int label = ++cur_label;
-            printf("  jz .L%d\n", label);
+            gen_profile_counter(node, 0);
             // body
             gen(node->for_stmt);
-            printf("  pop rax\n");
+            gen_pop("rax");
             // update expression
             printf("  .Lcontinue_%d:\n", continue_targets);
             if(node->for_update_expr) {
                 gen(node->for_update_expr);
-                printf("  pop rax\n");
+                gen_pop("rax");
+            }
+            // condition
+            printf(".L%d:\n", label_cond);
+            if(node->rhs) {
+                gen_cond_jump(node->rhs, true, label_for);
+            } else {
+                printf("  jmp .L%d\n", label_for);
             }
-            printf("  jmp .L%d\n", label_for);
             printf("  .Lbreak_%d:\n", break_target);
-            printf(".L%d:\n", label);
-            printf("  push rax\n");
+            gen_push("rax");
 
             vector_pop(break_target_vec);
             vector_pop(continue_target_vec);
@@ -402,20 +1916,18 @@ void gen(Node *node){
             int continue_targets = ++current_continue_target;
             vector_push(continue_target_vec, (void*)(long)continue_targets);
             int label_while = ++cur_label;
-            int label_while_end = ++cur_label;
 
+            gen_profile_counter(node, 1);
+            printf("  jmp .Lcontinue_%d\n", continue_targets);
+            gen_loop_align(node);
             printf(".L%d:\n", label_while);
-            printf(".Lcontinue_%d:\n", continue_targets);
-            gen(node->lhs);
-            printf("  pop rax\n");
-            printf("  test rax,rax\n");
-            printf("  jz .L%d\n", label_while_end);
+            gen_profile_counter(node, 0);
             gen(node->rhs);
-            printf("  pop rax\n");
-            printf("  jmp .L%d\n", label_while);
+            gen_pop("rax");
+            printf(".Lcontinue_%d:\n", continue_targets);
+            gen_cond_jump(node->lhs, true, label_while);
             printf("  .Lbreak_%d:\n", break_target);
-            printf(".L%d:\n", label_while_end);
-            printf("  push rax\n");
+            gen_push("rax");
 
             vector_pop(break_target_vec);
             vector_pop(continue_target_vec);
@@ -427,16 +1939,16 @@ void gen(Node *node){
             int continue_targets = ++current_continue_target;
             vector_push(continue_target_vec, (void*)(long)continue_targets);
             int label_do = ++cur_label;
+            gen_profile_counter(node, 1);
+            gen_loop_align(node);
             printf(".L%d:\n", label_do);
+            gen_profile_counter(node, 0);
             printf(".Lcontinue_%d:\n", continue_targets);
             gen(node->lhs);
-            printf("  pop rax\n");
-            gen(node->rhs);
-            printf("  pop rax\n");
-            printf("  test rax,rax\n");
-            printf("  jnz .L%d\n", label_do);
+            gen_pop("rax");
+            gen_cond_jump(node->rhs, true, label_do);
             printf("  .Lbreak_%d:\n", break_target);
-            printf("  push rax\n");
+            gen_push("rax");
 
             vector_pop(break_target_vec);
             vector_pop(continue_target_vec);
@@ -444,41 +1956,55 @@ void gen(Node *node){
         }
         case ND_COMPOUND:
             printf("  // compound %d\n", vector_size(node->compound_stmt_list));
+            gen_profile_counter(node, 0);
             for(int i = 0; i < vector_size(node->compound_stmt_list); i++){
                 gen(vector_get(node->compound_stmt_list, i));
-                printf("  pop rax\n");
+                gen_pop("rax");
             }
-            printf("  push rax\n");
+            gen_push("rax");
             return;
         case ND_CALL: {
+            gen_profile_counter(node, 0);
             if(node->lhs && node->lhs->kind == ND_GVAR && node->lhs->gvar.gvar->is_builtin) {
                 gen_builtin_call(node);
                 return;
             }
-            NodeList *cur = node->call_arg_list.next;
-            int reg_count = sizeof(args_regs) / sizeof(args_regs[0]);
-            int i;
-            for(i = 0; cur; cur = cur->next, i++){
-                gen(cur->node);
-            }
-            cur = node->call_arg_list.next;
-            for(int j = i-1; j >= 0; j--){
-                printf("  pop rax\n");
-                if(j < reg_count){
-                    printf("  mov %s,rax\n", args_regs[j]);
-                }else{
-                    error("call argument >= %d is not supported.", reg_count);
-                }
-            }
-            printf("  mov r15,rsp\n");
-            printf("  and rsp,~0xf\n");
+            int args_size = gen_call_args(node);
             // Number of floating point argument
             printf("  mov al,0\n");
             printf("  call %.*s\n", node->call_ident_len, node->call_ident);
-            printf("  mov rsp,r15\n");
-            printf("  push rax\n");
+            if(args_size) {
+                printf("  add rsp,%d\n", args_size);
+                gen_cfa();
+            }
+            gen_push("rax");
             return;
         }    
+        case ND_VECTOR_LOOP:
+            gen_vector_loop(node);
+            return;
+        case ND_MEMZERO:
+            gen_lvar(node->lhs);
+            gen_pop("rdi");
+            gen_push("rdi");
+            gen_zero(type_sizeof(node->expr_type));
+            return;
+        case ND_INLINE: {
+            // Returns in the inlined body jump to the end label with the value in rax.
+            int label = ++cur_label;
+            printf("  // inline %.*s\n", node->inline_.func->func_def.ident_len, node->inline_.func->func_def.ident);
+            if(node->lhs) {
+                gen(node->lhs);
+                gen_pop("rax");
+            }
+            vector_push(inline_return_vec, (void*)(long)label);
+            gen(node->rhs);
+            gen_pop("rax");
+            vector_pop(inline_return_vec);
+            printf(".Linline_ret_%d:\n", label);
+            gen_push("rax");
+            return;
+        }
         case ND_TYPE:
             // nop
             return;
@@ -489,16 +2015,48 @@ void gen(Node *node){
             // nop
             return;
         case ND_FUNC_DEF:
-            printf(".text\n");
+            // With -fprofile-use, functions not run in the training run are grouped apart from hot ones.
+            if(profile_is_cold(node)) {
+                printf(".section .text.unlikely,\"ax\",@progbits\n");
+            }else if(profile_is_hot(node)) {
+                printf(".section .text.hot,\"ax\",@progbits\n");
+            }else {
+                printf(".text\n");
+            }
             if(node->func_def.type_storage != TS_STATIC) {
                 printf(".globl %.*s\n", node->func_def.ident_len, node->func_def.ident);
             }
+            printf(".type %.*s, @function\n", node->func_def.ident_len, node->func_def.ident);
             printf("%.*s:\n", node->func_def.ident_len, node->func_def.ident);
+            printf("  .cfi_startproc\n");
             int size = vector_size(node->func_def.arg_vec);
-            printf("  push rbp\n");
-            printf("  push r15\n");
-            printf("  push rbx\n");
-            printf("  mov rbp,rsp\n");
+            tail_call_func = node;
+            // Only registers used by the body are saved.
+            saved_regs = new_vector();
+            for(int i = 0; i < node->func_def.saved_regs; i++){
+                vector_push(saved_regs, (char*)reg_vars[i]);
+            }
+            // return address
+            stack_depth = 8;
+            max_stack_depth = 8;
+            cfa_on_rsp = true;
+            if(node->func_def.uses_frame) {
+                gen_push("rbp");
+                printf("  .cfi_offset rbp, -%d\n", stack_depth);
+            }
+            for(int i = 0; i < vector_size(saved_regs); i++) {
+                gen_push((char*)vector_get(saved_regs, i));
+                printf("  .cfi_offset %s, -%d\n", (char*)vector_get(saved_regs, i), stack_depth);
+            }
+            if(node->func_def.uses_frame) {
+                printf("  mov rbp,rsp\n");
+                // CFA = rbp + stack_depth from here, whatever the body pushes.
+                printf("  .cfi_def_cfa_register rbp\n");
+                cfa_on_rsp = false;
+                frame_cfa_offset = stack_depth;
+            }
+            tail_call_label = ++cur_label;
+            printf(".Ltail_call_%d:\n", tail_call_label);
 
             /// stack layout: (from upper address to lower address)
             /// ...
@@ -506,8 +2064,7 @@ void gen(Node *node){
             /// arg7
             /// return address
             /// saved rbp
-            /// saved r15
-            /// saved rbx <- rbp points here
+            /// saved rbx, r12, r13, r14 (only used ones) <- rbp points here
             /// saved arguments for va_list (only used in var arg)
             /// saved arguments (To use arg as normal local variable)
             /// local var1
@@ -515,37 +2072,51 @@ void gen(Node *node){
             /// ...
             /// stack machine
             ///
+            /// Without locals on the stack, rbp is not set up.
             reserverd_stack_size = 0;
             if(node->func_def.type->is_vararg) {
                 reserverd_stack_size = args_reg_len * 8;
             }
-            printf("  // allocate stack\n");
-            printf("  sub rsp,%d\n", stack_align(node->func_def.max_stack_size + reserverd_stack_size));
+            if(node->func_def.uses_frame) {
+                printf("  // allocate stack\n");
+                int frame_size = stack_align(node->func_def.max_stack_size + reserverd_stack_size);
+                printf("  sub rsp,%d\n", frame_size);
+                grow_stack(frame_size);
+            }
             for(int i = 0; i < size; i++){
                 FuncDefArg *arg = vector_get(node->func_def.arg_vec, i);
                 printf("  // save argument %d: %.*s\n", i, arg->lvar->len, arg->lvar->name);
-                int size = type_sizeof(arg->lvar->type);
-                printf("  lea rax, [rbp-%d]\n", get_stack_sub_offset(arg->lvar));
-                printf("  push rax\n");
-                printf("  push %s\n", args_regs[i]);
-                char *out;
-                type_dump(arg->type, &out);
-                printf("  // type: %s\n", out);
-                store(type_sizeof(arg->type));
-                printf("  pop rax\n");
+                if(i < args_reg_len) {
+                    printf("  mov rax, %s\n", args_regs[i]);
+                }else {
+                    // above the return address
+                    int pushed = vector_size(saved_regs) + (node->func_def.uses_frame ? 1 : 0);
+                    printf("  mov rax, qword ptr [%s+%d]\n", node->func_def.uses_frame ? "rbp" : "rsp", (pushed + 1 + i - args_reg_len) * 8);
+                }
+                if(arg->lvar->reg) {
+                    gen_store_reg_var(arg->lvar);
+                }else if(node->func_def.uses_frame) {
+                    int size = type_sizeof(arg->lvar->type);
+                    printf("  mov %s [rbp-%d], %s\n", access_size(size), get_stack_sub_offset(arg->lvar), size == 1 ? "al" : size == 2 ? "ax" : size == 4 ? "eax" : "rax");
+                }
             }
             if(node->func_def.type->is_vararg) {
                 for(int i = 0; i < args_reg_len; i++) {
                     printf("  // save argument %d for va_list\n", i);
-                    printf("  lea rax, [rbp-%d]\n", (args_reg_len - 1 - i) * 8 + 8);
-                    printf("  push rax\n");
-                    printf("  push %s\n", args_regs[i]);
-                    store(8);
-                    printf("  pop rax\n");
+                    printf("  mov qword ptr [rbp-%d], %s\n", (args_reg_len - 1 - i) * 8 + 8, args_regs[i]);
                 }
             }
+            gen_profile_counter(node, 0);
+            if(is_instrumented(node)) {
+                gen_profile_hook("__cyg_profile_func_enter");
+            }
             gen(node->lhs);
             gen_return();
+            printf("  .cfi_endproc\n");
+            printf(".size %.*s, .-%.*s\n", node->func_def.ident_len, node->func_def.ident, node->func_def.ident_len, node->func_def.ident);
+            cfa_on_rsp = false;
+            gen_cold_blocks(node);
+            report_stack_usage(node);
             return;
         case ND_SCOPE: {
             printf("  // scope\n");
@@ -557,60 +2128,50 @@ void gen(Node *node){
                 gen(node->rhs);
             } else {
                 printf("  mov rax,0\n");
-                printf("  push rax\n");
+                gen_push("rax");
             }
 
             return;
         }
-        case ND_GVAR_DEF:
-            printf(".data\n");
-            printf(".globl %.*s\n", node->gvar_def.gvar->len, node->gvar_def.gvar->name);
-            printf("%.*s:\n", node->gvar_def.gvar->len, node->gvar_def.gvar->name);
-            Type *type = node->gvar_def.gvar->type;
-            gen_initexpr(type, node->gvar_def.init_expr);
+        case ND_GVAR_DEF: {
+            GVar *gvar = node->gvar_def.gvar;
+            Type *type = gvar->type;
+            int size = type_sizeof(type);
+            Node *init_expr = node->gvar_def.init_expr;
+            if(init_expr == NULL || is_zero_initializer(init_expr)) {
+                printf(".bss\n");
+                init_expr = NULL;
+            }else if(gvar->is_const) {
+                printf(".section .rodata\n");
+            }else {
+                printf(".data\n");
+            }
+            if(!gvar->is_static) {
+                printf(".globl %.*s\n", gvar->len, gvar->name);
+            }
+            // Arrays of 16 bytes or more are 16-byte aligned as the x86-64 ABI requires.
+            int align = type_alignof(type);
+            if(type->ty == ARRAY && size >= 16 && align < 16) {
+                align = 16;
+            }
+            if(align < gvar->align) {
+                align = gvar->align;
+            }
+            printf(".type %.*s, @object\n", gvar->len, gvar->name);
+            printf(".size %.*s, %d\n", gvar->len, gvar->name, size);
+            printf(".align %d\n", align);
+            printf("%.*s:\n", gvar->len, gvar->name);
+            gen_initexpr(type, init_expr);
             return;
+        }
         case ND_CONVERT:
             if(node->lhs->expr_type->ty == ARRAY && node->expr_type->ty == PTR) {
                 gen(node->lhs);
             } else {
                 gen(node->lhs);
-                char *out_from, *out_to;
-                type_dump(node->lhs->expr_type, &out_from);
-                type_dump(node->expr_type, &out_to);
-                int from_size = type_sizeof(node->lhs->expr_type);
-                int to_size = type_sizeof(node->expr_type);
-                printf("  // convert from %s to %s\n", out_from, out_to);
-                printf("  pop rax\n");
-                if(from_size > to_size) {
-                    // lowering size
-                    gen_lowering_rax(to_size);
-                }else if(from_size < to_size) {
-                    // enlarge size
-                    if(type_is_signed(node->lhs->expr_type)) {
-                        // signed to signed
-                        // (signed char)-16 -> (signed short)-16
-                        // or, signed to unsigned
-                        // (signed char)-16 -> (unsigned short)65520
-                        // Whether converting to signed or unsigned, bit representations are the same.
-                        if(from_size == 1) {
-                            printf("  movsx rax, al\n");
-                        } else if(from_size == 2) {
-                            printf("  movsx rax, ax\n");
-                        } else if(from_size == 4) {
-                            printf("  movsx rax, eax\n");
-                        } else if(from_size == 8) {
-                            error("Conversion unsupported for type %s to %s", out_from, out_to);
-                        }
-                        gen_lowering_rax(to_size);
-                    }else if(!type_is_signed(node->lhs->expr_type) && !type_is_signed(node->expr_type)) {
-                        // unsigned to unsigned
-                        gen_lowering_rax(from_size);
-                    }else {
-                        // unsigned to signed
-                        gen_lowering_rax(from_size);
-                    }
-                }
-                printf("  push rax\n");
+                gen_pop("rax");
+                gen_convert_rax(node);
+                gen_push("rax");
             }
             return;
         case ND_TYPE_EXTERN:
@@ -626,18 +2187,75 @@ void gen(Node *node){
             for(int i = 0; i < vector_size(node->decl_list_local.decls); i++) {
                 Node *decl = vector_get(node->decl_list_local.decls, i);
                 gen(decl);
-                printf("  pop rax\n");
+                gen_pop("rax");
             }
-            printf("  push rax\n");
+            gen_push("rax");
             return;
         case ND_CAST:
             gen(node->lhs);
             return;
     }
+    if(is_compare(node->kind)) {
+        bool is_signed = gen_compare(node);
+        printf("  set%s al\n", compare_cc(node->kind, is_signed));
+        printf("  movzb rax,al\n");
+        gen_push("rax");
+        return;
+    }
+    unsigned long const_val;
+    if((node->kind == ND_ADD || node->kind == ND_SUB) && get_const_value(node->rhs, &const_val) && is_imm32(const_val)) {
+        gen(node->lhs);
+        gen_pop("rax");
+        printf("  %s rax, %ld\n", node->kind == ND_ADD ? "add" : "sub", (long)const_val);
+        gen_push("rax");
+        return;
+    }
+    if(node->kind == ND_ADD && node->rhs->kind == ND_MUL && get_const_value(node->rhs->rhs, &const_val)
+            && (const_val == 1 || const_val == 2 || const_val == 4 || const_val == 8)) {
+        // pointer offset: scaled index addressing
+        gen(node->lhs);
+        gen(node->rhs->lhs);
+        gen_pop("rsi");
+        gen_pop("rax");
+        printf("  lea rax, [rax+rsi*%lu]\n", const_val);
+        gen_push("rax");
+        return;
+    }
+    if(node->kind == ND_MUL) {
+        Node *operand = NULL;
+        if(get_const_value(node->rhs, &const_val)) {
+            operand = node->lhs;
+        }else if(get_const_value(node->lhs, &const_val)) {
+            operand = node->rhs;
+        }
+        if(operand) {
+            gen(operand);
+            gen_pop("rax");
+            gen_mul_const(const_val);
+            gen_push("rax");
+            return;
+        }
+    }
+    if((node->kind == ND_DIV || node->kind == ND_MOD) && get_const_value(node->rhs, &const_val)) {
+        gen(node->lhs);
+        gen_pop("rax");
+        gen_extend_rax(node->expr_type);
+        if(gen_div_const(const_val, type_is_signed(node->expr_type), node->kind == ND_MOD)) {
+            gen_push("rax");
+            return;
+        }
+        gen_push("rax");
+        gen(node->rhs);
+        gen_pop("rsi");
+        gen_pop("rax");
+        gen_div(node);
+        gen_push("rax");
+        return;
+    }
     gen(node->lhs);
     gen(node->rhs);
-    printf("  pop rsi\n");
-    printf("  pop rax\n");
+    gen_pop("rsi");
+    gen_pop("rax");
     switch(node->kind){
         case ND_ADD:
             printf("  // add type:%d\n", node->lhs->expr_type->ty);
@@ -648,47 +2266,12 @@ void gen(Node *node){
             printf("  sub rax,rsi\n");
             break;
         case ND_MUL:
-            printf("  cqto\n");
-            printf("  mul rsi\n");
+            printf("  imul rax,rsi\n");
             break;
         case ND_DIV:
-            printf("  cqto\n");
-            printf("  div rsi\n");
-            break;
         case ND_MOD:
-            printf("  cqto\n");
-            printf("  div rsi\n");
-            printf("  mov rax, rdx\n");
-            break;
-        case ND_EQUAL:
-            printf("  cmp rax,rsi\n");
-            printf("  sete al\n");
-            printf("  movzb rax,al\n");
-            break;
-        case ND_NOT_EQUAL:
-            printf("  cmp rax,rsi\n");
-            printf("  setne al\n");
-            printf("  movzb rax,al\n");
-            break;
-        case ND_LESS:
-            printf("  cmp rax,rsi\n");
-            printf("  setl al\n");
-            printf("  movzb rax,al\n");
-            break;
-        case ND_LESS_OR_EQUAL:
-            printf("  cmp rax,rsi\n");
-            printf("  setle al\n");
-            printf("  movzb rax,al\n");
-            break;
-        case ND_GREATER:
-            printf("  cmp rax,rsi\n");
-            printf("  setg al\n");
-            printf("  movzb rax,al\n");
-            break;
-        case ND_GREATER_OR_EQUAL:
-            printf("  cmp rax,rsi\n");
-            printf("  setge al\n");
-            printf("  movzb rax,al\n");
+            gen_extend_rax(node->expr_type);
+            gen_div(node);
             break;
         case ND_OR:
             printf("  or rax,rsi\n");
@@ -711,12 +2294,31 @@ void gen(Node *node){
             printf("  mov rax, rsi\n");
             break;
     }
-    printf("  push rax\n");
+    gen_push("rax");
 }
 
 void init_codegen() {
+    if(stack_usage_path) {
+        stack_usage_file = fopen(stack_usage_path, "w");
+        if(!stack_usage_file) {
+            error("Cannot open %s", stack_usage_path);
+        }
+    }
     file_no_vec = new_vector();
     break_target_vec = new_vector();
     continue_target_vec = new_vector();
+    switch_number_vec = new_vector();
+    inline_return_vec = new_vector();
+    cold_blocks = new_vector();
+    gen_init_templates();
+}
+
+void finish_codegen() {
     gen_string_literals();
+    if(profile_generate && profile_counters) {
+        gen_profile_runtime();
+    }
+    if(stack_usage_file) {
+        fclose(stack_usage_file);
+    }
 }
@@ -12,6 +12,28 @@
 
 char *filename;
 int debug_parse = 0;
+bool dump_layout = false;
+bool dump_layout_json = false;
+bool stack_usage = false;
+// Directory of the profile file of -fprofile-generate=DIR and -fprofile-use=DIR.
+char *profile_dir;
+
+// Returns dir/base.suffix for dir/foo.c, where dir defaults to the current directory.
+char *auxiliary_file_name(char *dir, char *suffix) {
+    char *base = strrchr(filename, '/') ? strrchr(filename, '/') + 1 : filename;
+    int len = strlen(base);
+    if(len > 2 && strcmp(base + len - 2, ".c") == 0) {
+        len -= 2;
+    }
+    char *name = calloc((dir ? strlen(dir) + 1 : 0) + len + strlen(suffix) + 1, 1);
+    if(dir) {
+        strcat(name, dir);
+        strcat(name, "/");
+    }
+    strncat(name, base, len);
+    strcat(name, suffix);
+    return name;
+}
 
 int main(int argc, char **argv) {
   init_include_pathes();
@@ -33,6 +55,33 @@ int main(int argc, char **argv) {
           debug_parse = 1;
       }else if(strncmp(argv[i], "-t", 2) == 0){
           pp_debug = 1;
+      }else if(strcmp(argv[i], "-fno-inline") == 0){
+          opt_no_inline = true;
+      }else if(strcmp(argv[i], "-fno-optimize-sibling-calls") == 0){
+          opt_no_sibling_calls = true;
+      }else if(strcmp(argv[i], "-fdump-struct-layout") == 0){
+          dump_layout = true;
+      }else if(strcmp(argv[i], "-fdump-struct-layout=json") == 0){
+          dump_layout = true;
+          dump_layout_json = true;
+      }else if(strcmp(argv[i], "-finstrument-functions") == 0){
+          opt_instrument_functions = true;
+      }else if(strcmp(argv[i], "-fprofile-generate") == 0){
+          profile_generate = true;
+      }else if(strncmp(argv[i], "-fprofile-generate=", 19) == 0){
+          profile_generate = true;
+          profile_dir = argv[i] + 19;
+      }else if(strcmp(argv[i], "-fprofile-use") == 0){
+          profile_use = true;
+      }else if(strncmp(argv[i], "-fprofile-use=", 14) == 0){
+          profile_use = true;
+          profile_dir = argv[i] + 14;
+      }else if(strcmp(argv[i], "-fstack-usage") == 0){
+          stack_usage = true;
+      }else if(strncmp(argv[i], "-Wframe-larger-than=", 20) == 0){
+          frame_larger_than = atoi(argv[i] + 20);
+      }else if(strcmp(argv[i], "-mavx2") == 0){
+          opt_avx2 = true;
       } else {
           filename = argv[i];
           break;
@@ -44,6 +93,14 @@ int main(int argc, char **argv) {
       exit(1);
   }
 
+  if(stack_usage) {
+      // Like gcc, foo.su is written to the current directory for dir/foo.c.
+      stack_usage_path = auxiliary_file_name(NULL, ".su");
+  }
+  if(profile_generate || profile_use) {
+      profile_path = auxiliary_file_name(profile_dir, ".prof");
+  }
+
   user_input = read_file(filename);
   user_input_len = strlen(user_input);
 
@@ -54,8 +111,16 @@ int main(int argc, char **argv) {
     // debug_log("Preprocessed:\n%s", user_input);
   }
 
-  token = tokenize(user_input);
+  Token *tokens = tokenize(user_input);
+  token = tokens;
   Node *node_trans_unit = translation_unit();
+  if(dump_layout) {
+      dump_struct_layout(dump_layout_json);
+  }
+  if(profile_generate || profile_use) {
+      assign_profile_counters(node_trans_unit, tokens);
+  }
+  optimize(node_trans_unit);
 
   if(debug_parse) {
       for(int i = 0; i < vector_size(node_trans_unit->trans_unit.decl); i++){
@@ -69,6 +134,7 @@ int main(int argc, char **argv) {
   for(int i = 0; i < vector_size(node_trans_unit->trans_unit.decl); i++){
       gen(vector_get(node_trans_unit->trans_unit.decl, i));
   }
+  finish_codegen();
 
   return 0;
 }
@@ -0,0 +1,1914 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "rrcc.h"
+
+typedef struct CloneMap CloneMap;
+typedef struct CseEntry CseEntry;
+
+bool opt_no_inline = false;
+bool opt_avx2 = false;
+bool opt_no_sibling_calls = false;
+bool opt_instrument_functions = false;
+
+// Function definitions of the translation unit, used to look up callees.
+static Vector *func_defs;
+// Function which is currently optimized. Temporaries and inlined locals are allocated in its frame.
+static Node *current_func_def;
+// Callees which are being expanded. Used as recursion guard.
+static Vector *inline_stack;
+
+// Node count limits for inlining. A callee is inlined only if its body is smaller than these.
+static const int inline_limit_hinted = 120; // inline function
+static const int inline_limit_static = 48; // static function
+static const int inline_limit = 24; // others
+static const int inline_limit_cold = 8; // call sites not executed in the profile
+static const int inline_max_depth = 4;
+
+/// Node traversal ///
+
+// Collects pointers to the child slots of an expression or statement node.
+// Type nodes are not visited.
+static void child_slots(Node *node, Vector *slots) {
+    switch(node->kind) {
+        case ND_TYPE:
+        case ND_TYPE_POINTER:
+        case ND_TYPE_ARRAY:
+        case ND_TYPE_FUNC:
+        case ND_TYPE_STRUCT:
+        case ND_TYPE_ENUM:
+        case ND_TYPE_TYPEDEF:
+        case ND_TYPE_EXTERN:
+        case ND_FUNC_DECL:
+        case ND_DECL_LIST:
+        case ND_GVAR_DEF:
+        case ND_NUM:
+        case ND_STRING_LITERAL:
+        case ND_LVAR:
+        case ND_GVAR:
+        case ND_BREAK:
+        case ND_CONTINUE:
+            return;
+        case ND_DECL_VAR:
+            vector_push(slots, &node->rhs);
+            return;
+        case ND_IF:
+            vector_push(slots, &node->lhs);
+            vector_push(slots, &node->rhs);
+            vector_push(slots, &node->else_stmt);
+            return;
+        case ND_FOR:
+            vector_push(slots, &node->lhs);
+            vector_push(slots, &node->rhs);
+            vector_push(slots, &node->for_update_expr);
+            vector_push(slots, &node->for_stmt);
+            return;
+        case ND_COMPOUND:
+            for(int i = 0; i < vector_size(node->compound_stmt_list); i++) {
+                vector_push(slots, &node->compound_stmt_list->ptr[i]);
+            }
+            return;
+        case ND_DECL_LIST_LOCAL:
+            for(int i = 0; i < vector_size(node->decl_list_local.decls); i++) {
+                vector_push(slots, &node->decl_list_local.decls->ptr[i]);
+            }
+            return;
+        case ND_CALL:
+            for(NodeList *cur = node->call_arg_list.next; cur; cur = cur->next) {
+                vector_push(slots, &cur->node);
+            }
+            return;
+        case ND_VECTOR_LOOP:
+            vector_push(slots, &node->lhs);
+            vector_push(slots, &node->rhs);
+            vector_push(slots, &node->vector_loop->iv);
+            vector_push(slots, &node->vector_loop->bound);
+            vector_push(slots, &node->vector_loop->dest);
+            vector_push(slots, &node->vector_loop->acc);
+            vector_push(slots, &node->vector_loop->expr);
+            return;
+    }
+    vector_push(slots, &node->lhs);
+    vector_push(slots, &node->rhs);
+}
+
+static int count_nodes(Node *node) {
+    if(node == NULL) {
+        return 0;
+    }
+    int count = 1;
+    Vector *slots = new_vector();
+    child_slots(node, slots);
+    for(int i = 0; i < vector_size(slots); i++) {
+        Node **slot = vector_get(slots, i);
+        count += count_nodes(*slot);
+    }
+    return count;
+}
+
+/// Clone ///
+
+// Maps callee locals and nodes to their copies while a function body is cloned.
+struct CloneMap {
+    Vector *from_lvars;
+    Vector *to_lvars;
+    Vector *from_nodes;
+    Vector *to_nodes;
+    int base_offset;
+};
+
+static CloneMap *new_clone_map(int base_offset) {
+    CloneMap *map = calloc(1, sizeof(CloneMap));
+    map->from_lvars = new_vector();
+    map->to_lvars = new_vector();
+    map->from_nodes = new_vector();
+    map->to_nodes = new_vector();
+    map->base_offset = base_offset;
+    return map;
+}
+
+// Returns the copy of lvar placed in the caller's frame.
+static LVar *clone_lvar(CloneMap *map, LVar *lvar) {
+    for(int i = 0; i < vector_size(map->from_lvars); i++) {
+        if(vector_get(map->from_lvars, i) == lvar) {
+            return vector_get(map->to_lvars, i);
+        }
+    }
+    LVar *copy = calloc(1, sizeof(LVar));
+    copy->name = lvar->name;
+    copy->len = lvar->len;
+    copy->type = lvar->type;
+    copy->is_volatile = lvar->is_volatile;
+    copy->offset = lvar->offset + map->base_offset;
+    vector_push(map->from_lvars, lvar);
+    vector_push(map->to_lvars, copy);
+    return copy;
+}
+
+static Node *cloned_node(CloneMap *map, Node *node) {
+    for(int i = 0; i < vector_size(map->from_nodes); i++) {
+        if(vector_get(map->from_nodes, i) == node) {
+            return vector_get(map->to_nodes, i);
+        }
+    }
+    return NULL;
+}
+
+static Node *clone_tree(Node *node, CloneMap *map) {
+    if(node == NULL) {
+        return NULL;
+    }
+    Node *copy = calloc(1, sizeof(Node));
+    memcpy(copy, node, sizeof(Node));
+    vector_push(map->from_nodes, node);
+    vector_push(map->to_nodes, copy);
+
+    if(node->kind == ND_LVAR) {
+        copy->lvar = clone_lvar(map, node->lvar);
+    }else if(node->kind == ND_DECL_VAR) {
+        copy->decl_var.lvar = clone_lvar(map, node->decl_var.lvar);
+    }else if(node->kind == ND_COMPOUND) {
+        copy->compound_stmt_list = vector_dup(node->compound_stmt_list);
+    }else if(node->kind == ND_DECL_LIST_LOCAL) {
+        copy->decl_list_local.decls = vector_dup(node->decl_list_local.decls);
+    }else if(node->kind == ND_VECTOR_LOOP) {
+        // The slots of the loop description are rewritten to the clones below.
+        copy->vector_loop = calloc(1, sizeof(VectorLoop));
+        memcpy(copy->vector_loop, node->vector_loop, sizeof(VectorLoop));
+    }else if(node->kind == ND_CALL) {
+        // Whether the call is in tail position depends on the caller.
+        copy->is_tail_call = false;
+        NodeList *tail = &copy->call_arg_list;
+        for(NodeList *cur = node->call_arg_list.next; cur; cur = cur->next) {
+            NodeList *nodelist = calloc(1, sizeof(NodeList));
+            nodelist->node = cur->node;
+            tail->next = nodelist;
+            tail = nodelist;
+        }
+    }
+
+    Vector *slots = new_vector();
+    child_slots(copy, slots);
+    for(int i = 0; i < vector_size(slots); i++) {
+        Node **slot = vector_get(slots, i);
+        *slot = clone_tree(*slot, map);
+    }
+
+    if(node->kind == ND_SWITCH) {
+        // case and default statements are owned by the body, which is cloned above.
+        copy->switch_.cases = new_vector();
+        for(int i = 0; i < vector_size(node->switch_.cases); i++) {
+            vector_push(copy->switch_.cases, cloned_node(map, vector_get(node->switch_.cases, i)));
+        }
+        if(node->switch_.default_stmt) {
+            copy->switch_.default_stmt = cloned_node(map, node->switch_.default_stmt);
+        }
+    }
+    return copy;
+}
+
+/// Profile ///
+
+bool profile_generate = false;
+bool profile_use = false;
+// Written by the program built with -fprofile-generate and read by -fprofile-use.
+char *profile_path;
+int profile_counters = 0;
+// Identifies the source the counters are numbered for. Profiles of another source are ignored.
+unsigned long profile_checksum = 0;
+// Counts were read by -fprofile-use.
+static bool profile_loaded = false;
+// Nodes executed at least this many times are hot.
+static unsigned long profile_hot_count = 1;
+static unsigned long *profile_counts;
+
+// Number of counters of node: the executions of each branch target, and the entries of loops and functions.
+// IF: then, else. Loops: body, entries. Functions, calls, case and default labels: executions.
+static int profile_counter_slots(Node *node) {
+    switch(node->kind) {
+        case ND_FUNC_DEF:
+        case ND_CASE:
+        case ND_DEFAULT:
+            return 1;
+        case ND_IF:
+        case ND_FOR:
+        case ND_WHILE:
+        case ND_DO:
+            return 2;
+        case ND_CALL:
+            return node->lhs && node->lhs->kind == ND_GVAR && node->lhs->gvar.gvar->is_builtin ? 0 : 1;
+    }
+    return 0;
+}
+
+// Counters are numbered before any optimization, so that both builds number the same nodes.
+// Copies made by inlining share the counters of the original.
+static void number_profile_counters(Node *node) {
+    if(node == NULL) {
+        return;
+    }
+    int slots = profile_counter_slots(node);
+    if(slots) {
+        node->prof_counter = profile_counters + 1;
+        profile_counters += slots;
+    }
+    Vector *children = new_vector();
+    child_slots(node, children);
+    for(int i = 0; i < vector_size(children); i++) {
+        Node **slot = vector_get(children, i);
+        number_profile_counters(*slot);
+    }
+}
+
+static void annotate_profile_counts(Node *node) {
+    if(node == NULL) {
+        return;
+    }
+    int slots = profile_counter_slots(node);
+    for(int i = 0; node->prof_counter && i < slots; i++) {
+        node->prof_count[i] = profile_counts[node->prof_counter - 1 + i];
+    }
+    Vector *children = new_vector();
+    child_slots(node, children);
+    for(int i = 0; i < vector_size(children); i++) {
+        Node **slot = vector_get(children, i);
+        annotate_profile_counts(*slot);
+    }
+}
+
+// Adds the executions of the calls in node to the functions of funcs they call.
+static void sum_call_counts(Node *node, Vector *funcs, unsigned long *calls) {
+    if(node == NULL) {
+        return;
+    }
+    if(node->kind == ND_CALL && node->prof_counter && node->lhs && node->lhs->kind == ND_GVAR) {
+        GVar *gvar = node->lhs->gvar.gvar;
+        for(int i = 0; i < vector_size(funcs); i++) {
+            Node *func = vector_get(funcs, i);
+            if(compare_ident(func->func_def.ident, func->func_def.ident_len, gvar->name, gvar->len)) {
+                calls[i] += node->prof_count[0];
+            }
+        }
+    }
+    Vector *children = new_vector();
+    child_slots(node, children);
+    for(int i = 0; i < vector_size(children); i++) {
+        Node **slot = vector_get(children, i);
+        sum_call_counts(*slot, funcs, calls);
+    }
+}
+
+static void load_profile(Vector *funcs) {
+    FILE *fp = fopen(profile_path, "rb");
+    if(!fp) {
+        // Like gcc, a missing profile compiles without feedback.
+        return;
+    }
+    unsigned long *header = calloc(2, sizeof(unsigned long));
+    profile_counts = calloc(profile_counters + 1, sizeof(unsigned long));
+    bool valid = fread(header, sizeof(unsigned long), 2, fp) == 2
+        && header[0] == profile_checksum && header[1] == profile_counters
+        && fread(profile_counts, sizeof(unsigned long), profile_counters, fp) == profile_counters;
+    fclose(fp);
+    if(!valid) {
+        fprintf(stderr, "warning: profile %s does not match the source, ignored\n", profile_path);
+        return;
+    }
+    profile_loaded = true;
+    unsigned long max_count = 0;
+    for(int i = 0; i < profile_counters; i++) {
+        if(max_count < profile_counts[i]) {
+            max_count = profile_counts[i];
+        }
+    }
+    profile_hot_count = max_count / 16 > 1 ? max_count / 16 : 1;
+    for(int i = 0; i < vector_size(funcs); i++) {
+        Node *func = vector_get(funcs, i);
+        func->prof_count[0] = profile_counts[func->prof_counter - 1];
+        annotate_profile_counts(func->lhs);
+    }
+    // Inlined copies do not count entries of the function, but the inlined call still counts.
+    unsigned long *calls = calloc(vector_size(funcs) + 1, sizeof(unsigned long));
+    for(int i = 0; i < vector_size(funcs); i++) {
+        Node *func = vector_get(funcs, i);
+        sum_call_counts(func->lhs, funcs, calls);
+    }
+    for(int i = 0; i < vector_size(funcs); i++) {
+        Node *func = vector_get(funcs, i);
+        if(func->prof_count[0] < calls[i]) {
+            func->prof_count[0] = calls[i];
+        }
+    }
+}
+
+// tokens are the preprocessed source. The checksum covers them, so that edits of headers are detected too.
+void assign_profile_counters(Node *trans_unit, Token *tokens) {
+    Vector *funcs = new_vector();
+    Vector *decls = trans_unit->trans_unit.decl;
+    for(int i = 0; i < vector_size(decls); i++) {
+        Node *decl = vector_get(decls, i);
+        if(decl->kind == ND_FUNC_DEF) {
+            decl->prof_counter = ++profile_counters;
+            number_profile_counters(decl->lhs);
+            vector_push(funcs, decl);
+        }
+    }
+    profile_checksum = profile_counters;
+    for(Token *tok = tokens; tok; tok = tok->next) {
+        profile_checksum = profile_checksum * 31 + tok->kind;
+        for(int i = 0; i < tok->len; i++) {
+            profile_checksum = profile_checksum * 31 + (unsigned char)tok->str[i];
+        }
+    }
+    if(profile_use) {
+        load_profile(funcs);
+    }
+}
+
+// Executions of node's first counter, 0 without a profile.
+unsigned long profile_count(Node *node) {
+    return profile_loaded && node->prof_counter ? node->prof_count[0] : 0;
+}
+
+// Not executed in the training run.
+bool profile_is_cold(Node *node) {
+    return profile_loaded && node->prof_counter && node->prof_count[0] == 0;
+}
+
+bool profile_is_hot(Node *node) {
+    return profile_loaded && node->prof_counter && node->prof_count[0] >= profile_hot_count;
+}
+
+// The else branch of an IF was taken more often than the then branch.
+bool profile_else_is_likely(Node *node) {
+    return profile_loaded && node->prof_counter && node->prof_count[1] > node->prof_count[0];
+}
+
+/// Branch prediction ///
+
+// Functions which never return, besides those declared _Noreturn or __attribute__((noreturn)).
+// The system headers hide the attribute from us. Functions defined in this file are not looked up here.
+static char *noreturn_funcs[] = {"exit", "_Exit", "quick_exit", "abort", "__assert_fail", "longjmp", "siglongjmp", "pthread_exit", "err", "errx", NULL};
+
+// If node is __builtin_expect(exp, c) with constant c, stores exp and c and returns true.
+bool builtin_expect_operand(Node *node, Node **exp, unsigned long *expected) {
+    while(node->kind == ND_CONVERT || node->kind == ND_CAST) {
+        node = node->lhs;
+    }
+    if(node->kind != ND_CALL || !node->lhs || node->lhs->kind != ND_GVAR || !node->lhs->gvar.gvar->is_builtin
+            || strcmp(node->lhs->gvar.gvar->name, "__builtin_expect") != 0) {
+        return false;
+    }
+    Node *hint = constant_fold(node->call_arg_list.next->next->node);
+    if(hint->kind != ND_NUM) {
+        return false;
+    }
+    *exp = node->call_arg_list.next->node;
+    // The operand is converted to long, which keeps whether it is zero.
+    while((*exp)->kind == ND_CONVERT) {
+        *exp = (*exp)->lhs;
+    }
+    *expected = hint->val;
+    return true;
+}
+
+static Node *find_func_def(char *ident, int ident_len);
+
+static bool is_noreturn_call(Node *node) {
+    if(node->kind != ND_CALL || !node->lhs || node->lhs->kind != ND_GVAR) {
+        return false;
+    }
+    GVar *gvar = node->lhs->gvar.gvar;
+    if(gvar->is_noreturn) {
+        return true;
+    }
+    if(find_func_def(gvar->name, gvar->len)) {
+        return false;
+    }
+    for(int i = 0; noreturn_funcs[i]; i++) {
+        if(compare_slice(gvar->name, gvar->len, noreturn_funcs[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// An error path: the statement always ends in a call which does not return.
+static bool calls_noreturn(Node *node) {
+    if(node == NULL) {
+        return false;
+    }
+    if(node->kind == ND_SCOPE) {
+        return calls_noreturn(node->lhs);
+    }
+    if(node->kind == ND_COMPOUND) {
+        for(int i = 0; i < vector_size(node->compound_stmt_list); i++) {
+            if(calls_noreturn(vector_get(node->compound_stmt_list, i))) {
+                return true;
+            }
+        }
+        return false;
+    }
+    return is_noreturn_call(node);
+}
+
+// The branch of an IF is rarely executed, and is moved out of the hot code.
+// The profile decides if there is one, otherwise __builtin_expect and calls to noreturn functions.
+bool branch_is_cold(Node *node, bool then_branch) {
+    Node *branch = then_branch ? node->rhs : node->else_stmt;
+    if(branch == NULL) {
+        return false;
+    }
+    if(profile_loaded && node->prof_counter) {
+        unsigned long count = then_branch ? node->prof_count[0] : node->prof_count[1];
+        unsigned long other = then_branch ? node->prof_count[1] : node->prof_count[0];
+        return count == 0 && other > 0;
+    }
+    Node *exp;
+    unsigned long expected;
+    if(builtin_expect_operand(node->lhs, &exp, &expected)) {
+        return then_branch == (expected == 0);
+    }
+    return calls_noreturn(branch);
+}
+
+// Hot loops get their header aligned. Without a profile every loop is taken as hot.
+bool loop_is_hot(Node *node) {
+    if(profile_loaded && node->prof_counter) {
+        return node->prof_count[0] >= profile_hot_count;
+    }
+    return true;
+}
+
+/// Inline ///
+
+static Node *find_func_def(char *ident, int ident_len) {
+    for(int i = 0; i < vector_size(func_defs); i++) {
+        Node *func = vector_get(func_defs, i);
+        if(compare_ident(func->func_def.ident, func->func_def.ident_len, ident, ident_len)) {
+            return func;
+        }
+    }
+    return NULL;
+}
+
+static int call_arg_count(Node *call) {
+    int count = 0;
+    for(NodeList *cur = call->call_arg_list.next; cur; cur = cur->next) {
+        count++;
+    }
+    return count;
+}
+
+static bool can_inline(Node *call, Node *callee) {
+    if(callee == NULL || callee == current_func_def) {
+        return false;
+    }
+    if(vector_size(inline_stack) >= inline_max_depth) {
+        return false;
+    }
+    for(int i = 0; i < vector_size(inline_stack); i++) {
+        if(vector_get(inline_stack, i) == callee) {
+            return false;
+        }
+    }
+    if(callee->func_def.type->is_vararg || is_instrumented(callee)) {
+        return false;
+    }
+    if(call_arg_count(call) != vector_size(callee->func_def.arg_vec)) {
+        return false;
+    }
+    for(int i = 0; i < vector_size(callee->func_def.arg_vec); i++) {
+        FuncDefArg *arg = vector_get(callee->func_def.arg_vec, i);
+        if(!type_is_scalar(arg->type)) {
+            return false;
+        }
+    }
+
+    int limit = inline_limit;
+    if(callee->func_def.is_inline || profile_is_hot(call)) {
+        limit = inline_limit_hinted;
+    }else if(callee->func_def.type_storage == TS_STATIC) {
+        limit = inline_limit_static;
+    }
+    if(profile_is_cold(call)) {
+        limit = inline_limit_cold;
+    }
+    return count_nodes(callee->lhs) <= limit;
+}
+
+static Node *inline_walk(Node *node);
+
+// Substitutes the body of callee at the call site.
+// Locals of the callee are remapped to a fresh area at the end of the caller's frame,
+// and parameters are initialized by assignment from the arguments.
+static Node *inline_call(Node *call, Node *callee) {
+    CloneMap *map = new_clone_map(current_func_def->func_def.max_stack_size);
+    current_func_def->func_def.max_stack_size += callee->func_def.max_stack_size;
+
+    Node *args = new_node(ND_COMPOUND, NULL, NULL);
+    args->compound_stmt_list = new_vector();
+    NodeList *cur = call->call_arg_list.next;
+    for(int i = 0; cur; cur = cur->next, i++) {
+        FuncDefArg *arg = vector_get(callee->func_def.arg_vec, i);
+        Node *param = new_node_lvar(clone_lvar(map, arg->lvar));
+        vector_push(args->compound_stmt_list, new_node_assignment(param, cur->node));
+    }
+
+    // The argument assignments run once per call, so they carry the call's counter.
+    if(profile_generate) {
+        args->prof_counter = call->prof_counter;
+    }
+
+    Node *node;
+    Node *body = callee->lhs;
+    Vector *stmts = body->lhs->lhs->compound_stmt_list;
+    Node *first = NULL;
+    if(vector_size(stmts) == 1) {
+        first = vector_get(stmts, 0);
+    }
+    vector_push(inline_stack, callee);
+    if(first && first->kind == ND_RETURN && first->lhs) {
+        // Simple accessor: { return expr; } is expanded to (params = args, expr).
+        node = inline_walk(clone_tree(first->lhs, map));
+        if(vector_size(args->compound_stmt_list) || args->prof_counter) {
+            node = new_node(ND_COMMA_EXPR, args, node);
+        }
+    }else {
+        node = new_node(ND_INLINE, NULL, inline_walk(clone_tree(body, map)));
+        if(vector_size(args->compound_stmt_list) || args->prof_counter) {
+            node->lhs = args;
+        }
+        node->inline_.func = callee;
+    }
+    vector_pop(inline_stack);
+    node->expr_type = call->expr_type;
+    node->line_info = call->line_info;
+    return node;
+}
+
+static Node *inline_walk(Node *node) {
+    if(node == NULL) {
+        return NULL;
+    }
+    Vector *slots = new_vector();
+    child_slots(node, slots);
+    for(int i = 0; i < vector_size(slots); i++) {
+        Node **slot = vector_get(slots, i);
+        *slot = inline_walk(*slot);
+    }
+    if(node->kind == ND_CALL && node->lhs && node->lhs->kind == ND_GVAR && !node->lhs->gvar.gvar->is_builtin) {
+        Node *callee = find_func_def(node->call_ident, node->call_ident_len);
+        if(can_inline(node, callee)) {
+            return inline_call(node, callee);
+        }
+    }
+    return node;
+}
+
+/// Loop-invariant code motion ///
+
+// Locals whose address is taken in the current function. Their loads may be clobbered by stores through pointers.
+static Vector *address_taken_lvars;
+
+static bool vector_contains(Vector *vec, void *elem) {
+    for(int i = 0; i < vector_size(vec); i++) {
+        if(vector_get(vec, i) == elem) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Rewrites *(char*)&x + 0 with the type of x (emitted for initializers) to plain x,
+// so that initialized scalars are not regarded as address-taken.
+static Node *canonicalize_lvar_access(Node *node) {
+    if(node == NULL) {
+        return NULL;
+    }
+    Vector *slots = new_vector();
+    child_slots(node, slots);
+    for(int i = 0; i < vector_size(slots); i++) {
+        Node **slot = vector_get(slots, i);
+        *slot = canonicalize_lvar_access(*slot);
+    }
+    if(node->kind != ND_DEREF || node->lhs->kind != ND_ADD || node->lhs->rhs->kind != ND_NUM || node->lhs->rhs->val != 0) {
+        return node;
+    }
+    Node *base = node->lhs->lhs;
+    if(base->kind == ND_CONVERT) {
+        base = base->lhs;
+    }
+    if(base->kind != ND_ADDRESS_OF || base->lhs->kind != ND_LVAR) {
+        return node;
+    }
+    Type *type = base->lhs->lvar->type;
+    if(!type_is_scalar(type) || !type_is_same(type, node->expr_type)) {
+        return node;
+    }
+    return base->lhs;
+}
+
+static void collect_address_taken(Node *node) {
+    if(node == NULL) {
+        return;
+    }
+    if(node->kind == ND_ADDRESS_OF && node->lhs->kind == ND_LVAR) {
+        vector_push(address_taken_lvars, node->lhs->lvar);
+    }
+    Vector *slots = new_vector();
+    child_slots(node, slots);
+    for(int i = 0; i < vector_size(slots); i++) {
+        Node **slot = vector_get(slots, i);
+        collect_address_taken(*slot);
+    }
+}
+
+// Collects locals which are assigned or declared in node.
+static void collect_modified(Node *node, Vector *modified) {
+    if(node == NULL) {
+        return;
+    }
+    if((node->kind == ND_ASSIGN || node->kind == ND_POSTFIX_INC || node->kind == ND_POSTFIX_DEC
+            || node->kind == ND_PREFIX_INC || node->kind == ND_PREFIX_DEC) && node->lhs->kind == ND_LVAR) {
+        vector_push(modified, node->lhs->lvar);
+    }else if(node->kind == ND_DECL_VAR) {
+        vector_push(modified, node->decl_var.lvar);
+    }
+    Vector *slots = new_vector();
+    child_slots(node, slots);
+    for(int i = 0; i < vector_size(slots); i++) {
+        Node **slot = vector_get(slots, i);
+        collect_modified(*slot, modified);
+    }
+}
+
+// Whether node is free of side effects and traps, and evaluates to the same value in every iteration.
+static bool is_invariant(Node *node, Vector *modified) {
+    switch(node->kind) {
+        case ND_NUM:
+        case ND_STRING_LITERAL:
+            return true;
+        case ND_LVAR:
+            if(node->expr_type->ty == ARRAY) {
+                return true;
+            }
+            return type_is_scalar(node->expr_type) && !node->lvar->is_volatile
+                && !vector_contains(address_taken_lvars, node->lvar) && !vector_contains(modified, node->lvar);
+        case ND_GVAR:
+            return node->expr_type->ty == ARRAY;
+        case ND_ADDRESS_OF:
+            return node->lhs->kind == ND_LVAR || node->lhs->kind == ND_GVAR;
+        case ND_DEREF:
+            // Arrays evaluate to their address
+            return node->expr_type->ty == ARRAY && is_invariant(node->lhs, modified);
+        case ND_CONVERT:
+        case ND_CAST:
+        case ND_BIT_NOT:
+            return is_invariant(node->lhs, modified);
+        case ND_DIV:
+        case ND_MOD:
+            if(node->rhs->kind != ND_NUM || node->rhs->val == 0 || node->rhs->val == ~0UL) {
+                return false;
+            }
+            return is_invariant(node->lhs, modified);
+        case ND_ADD:
+        case ND_SUB:
+        case ND_MUL:
+        case ND_AND:
+        case ND_OR:
+        case ND_XOR:
+        case ND_LSHIFT:
+        case ND_RSHIFT:
+        case ND_EQUAL:
+        case ND_NOT_EQUAL:
+        case ND_LESS:
+        case ND_LESS_OR_EQUAL:
+        case ND_GREATER:
+        case ND_GREATER_OR_EQUAL:
+            return is_invariant(node->lhs, modified) && is_invariant(node->rhs, modified);
+    }
+    return false;
+}
+
+// Hoisting pays off only if the expression computes something.
+static bool is_worth_hoisting(Node *node) {
+    if(node->expr_type == NULL || !type_is_scalar(node->expr_type) || type_sizeof(node->expr_type) > 8) {
+        return false;
+    }
+    switch(node->kind) {
+        case ND_ADD:
+        case ND_SUB:
+        case ND_MUL:
+        case ND_DIV:
+        case ND_MOD:
+        case ND_AND:
+        case ND_OR:
+        case ND_XOR:
+        case ND_LSHIFT:
+        case ND_RSHIFT:
+        case ND_BIT_NOT:
+            return true;
+        case ND_CONVERT:
+        case ND_CAST:
+            return is_worth_hoisting(node->lhs);
+    }
+    return false;
+}
+
+// Allocates a temporary in the frame of the current function.
+static LVar *new_temp_lvar(Type *type) {
+    LVar *lvar = calloc(1, sizeof(LVar));
+    lvar->name = "opt.tmp";
+    lvar->len = strlen(lvar->name);
+    lvar->type = type;
+    lvar->offset = current_func_def->func_def.max_stack_size;
+    current_func_def->func_def.max_stack_size += 8;
+    return lvar;
+}
+
+// Replaces maximal invariant subexpressions under *slot with temporaries,
+// and collects assignments to the temporaries into hoisted.
+static void hoist_invariants(Node **slot, Vector *modified, Vector *hoisted) {
+    Node *node = *slot;
+    if(node == NULL) {
+        return;
+    }
+    if(is_worth_hoisting(node) && is_invariant(node, modified)) {
+        LVar *tmp = new_temp_lvar(node->expr_type);
+        vector_push(hoisted, new_node_assignment(new_node_lvar(tmp), node));
+        *slot = new_node_lvar(tmp);
+        return;
+    }
+    Vector *slots = new_vector();
+    child_slots(node, slots);
+    for(int i = 0; i < vector_size(slots); i++) {
+        hoist_invariants(vector_get(slots, i), modified, hoisted);
+    }
+}
+
+/// Induction variables ///
+
+static Node *strip_convert(Node *node) {
+    while(node->kind == ND_CONVERT || node->kind == ND_CAST) {
+        node = node->lhs;
+    }
+    return node;
+}
+
+// Whether a counter of type can be assumed not to wrap around.
+// Narrower and unsigned counters wrap, and pointers derived from them would run past the wrap.
+static bool is_non_wrapping_counter(Type *type) {
+    return type_is_int(type) && type_is_signed(type) && type_sizeof(type) >= 4;
+}
+
+// Returns the integer local counted by update (i++, i--, ++i, --i, i += c, i = i + c) and its step.
+// Only signed counters at least int wide are accepted.
+static LVar *basic_induction_var(Node *update, long *step) {
+    if(update == NULL) {
+        return NULL;
+    }
+    if(update->kind == ND_POSTFIX_INC || update->kind == ND_POSTFIX_DEC
+            || update->kind == ND_PREFIX_INC || update->kind == ND_PREFIX_DEC) {
+        if(update->lhs->kind != ND_LVAR || !is_non_wrapping_counter(update->lhs->expr_type)) {
+            return NULL;
+        }
+        *step = update->incdec.value;
+        return update->lhs->lvar;
+    }
+    if(update->kind != ND_ASSIGN || update->lhs->kind != ND_LVAR || !is_non_wrapping_counter(update->lhs->expr_type)) {
+        return NULL;
+    }
+    LVar *lvar = update->lhs->lvar;
+    Node *rhs = strip_convert(update->rhs);
+    if((rhs->kind != ND_ADD && rhs->kind != ND_SUB) || rhs->rhs->kind != ND_NUM) {
+        return NULL;
+    }
+    Node *var = strip_convert(rhs->lhs);
+    if(var->kind != ND_LVAR || var->lvar != lvar) {
+        return NULL;
+    }
+    *step = rhs->kind == ND_ADD ? (long)rhs->rhs->val : -(long)rhs->rhs->val;
+    return lvar;
+}
+
+// Whether node is an address base + index * size, where index is iv, iv + e, e + iv or iv - e with invariant e.
+static bool is_iv_address(Node *node, LVar *iv, Vector *modified) {
+    if(node->kind != ND_ADD || node->expr_type == NULL || node->expr_type->ty != PTR) {
+        return false;
+    }
+    if(node->rhs->kind != ND_MUL || node->rhs->rhs->kind != ND_NUM || !is_invariant(node->lhs, modified)) {
+        return false;
+    }
+    Node *index = strip_convert(node->rhs->lhs);
+    if(index->kind == ND_LVAR) {
+        return index->lvar == iv;
+    }
+    if(index->kind != ND_ADD && index->kind != ND_SUB) {
+        return false;
+    }
+    Node *lhs = strip_convert(index->lhs);
+    Node *rhs = strip_convert(index->rhs);
+    if(lhs->kind == ND_LVAR && lhs->lvar == iv) {
+        return is_invariant(index->rhs, modified);
+    }
+    if(index->kind == ND_ADD && rhs->kind == ND_LVAR && rhs->lvar == iv) {
+        return is_invariant(index->lhs, modified);
+    }
+    return false;
+}
+
+// Replaces addresses affine in iv with pointer temporaries.
+// Initial values are appended to inits, and the temporaries to pointers.
+static void replace_iv_addresses(Node **slot, LVar *iv, Vector *modified, Vector *inits, Vector *pointers) {
+    Node *node = *slot;
+    if(node == NULL) {
+        return;
+    }
+    if(is_iv_address(node, iv, modified)) {
+        LVar *tmp = new_temp_lvar(node->expr_type);
+        tmp->name = "opt.iv";
+        tmp->len = strlen(tmp->name);
+        vector_push(inits, new_node_assignment(new_node_lvar(tmp), node));
+        vector_push(pointers, tmp);
+        *slot = new_node_lvar(tmp);
+        return;
+    }
+    Vector *slots = new_vector();
+    child_slots(node, slots);
+    for(int i = 0; i < vector_size(slots); i++) {
+        replace_iv_addresses(vector_get(slots, i), iv, modified, inits, pointers);
+    }
+}
+
+static int count_lvar_refs(Node *node, LVar *lvar) {
+    if(node == NULL) {
+        return 0;
+    }
+    int count = 0;
+    if(node->kind == ND_LVAR && node->lvar == lvar) {
+        count++;
+    }
+    Vector *slots = new_vector();
+    child_slots(node, slots);
+    for(int i = 0; i < vector_size(slots); i++) {
+        Node **slot = vector_get(slots, i);
+        count += count_lvar_refs(*slot, lvar);
+    }
+    return count;
+}
+
+static bool declares_lvar(Node *node, LVar *lvar) {
+    if(node == NULL) {
+        return false;
+    }
+    if(node->kind == ND_DECL_VAR && node->decl_var.lvar == lvar) {
+        return true;
+    }
+    Vector *slots = new_vector();
+    child_slots(node, slots);
+    for(int i = 0; i < vector_size(slots); i++) {
+        Node **slot = vector_get(slots, i);
+        if(declares_lvar(*slot, lvar)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void append_preheader(Node *loop, Node *assign) {
+    if(loop->lhs) {
+        loop->lhs = new_node(ND_COMMA_EXPR, loop->lhs, assign);
+        loop->lhs->expr_type = assign->expr_type;
+    }else {
+        loop->lhs = assign;
+    }
+}
+
+static Node *append_expr(Node *expr, Node *next) {
+    if(expr == NULL) {
+        return next;
+    }
+    Node *node = new_node(ND_COMMA_EXPR, expr, next);
+    node->expr_type = next->expr_type;
+    return node;
+}
+
+// Whether the exit test cond compares iv against an invariant bound in the direction of step.
+static bool is_iv_exit_test(Node *cond, LVar *iv, long step, Vector *modified) {
+    if(cond == NULL || cond->lhs == NULL || cond->lhs->kind != ND_LVAR || cond->lhs->lvar != iv) {
+        return false;
+    }
+    if(!type_is_same(cond->rhs->expr_type, iv->type) || !is_invariant(cond->rhs, modified)) {
+        return false;
+    }
+    if(cond->kind == ND_NOT_EQUAL) {
+        return true;
+    }
+    if(step > 0) {
+        return cond->kind == ND_LESS || cond->kind == ND_LESS_OR_EQUAL;
+    }
+    return cond->kind == ND_GREATER || cond->kind == ND_GREATER_OR_EQUAL;
+}
+
+// Strength-reduces a[i] in for loops counted by i to pointers stepping by the element size.
+// If i is declared by the loop and used only for the exit test afterwards, the exit test is
+// rewritten to compare the pointer and i is no longer updated.
+static void optimize_induction(Node *node) {
+    long step;
+    LVar *iv = basic_induction_var(node->for_update_expr, &step);
+    if(iv == NULL || step == 0 || vector_contains(address_taken_lvars, iv)) {
+        return;
+    }
+    Vector *body_modified = new_vector();
+    collect_modified(node->rhs, body_modified);
+    collect_modified(node->for_stmt, body_modified);
+    if(vector_contains(body_modified, iv)) {
+        return;
+    }
+    Vector *modified = new_vector();
+    collect_modified(node->for_update_expr, modified);
+    for(int i = 0; i < vector_size(body_modified); i++) {
+        vector_push(modified, vector_get(body_modified, i));
+    }
+
+    Vector *inits = new_vector();
+    Vector *pointers = new_vector();
+    replace_iv_addresses(&node->rhs, iv, modified, inits, pointers);
+    replace_iv_addresses(&node->for_stmt, iv, modified, inits, pointers);
+    if(vector_size(pointers) == 0) {
+        return;
+    }
+    Node *increments = NULL;
+    for(int i = 0; i < vector_size(pointers); i++) {
+        LVar *ptr = vector_get(pointers, i);
+        append_preheader(node, vector_get(inits, i));
+        Node *num = new_node_num(step * type_sizeof(ptr->type->ptr_to));
+        num->expr_type = &signed_long_type;
+        Node *add = new_node(ND_ADD, new_node_lvar(ptr), num);
+        add->expr_type = ptr->type;
+        increments = append_expr(increments, new_node_assignment(new_node_lvar(ptr), add));
+    }
+
+    Node *cond = node->rhs;
+    if(!declares_lvar(node->lhs, iv) || !is_iv_exit_test(cond, iv, step, modified)
+            || count_lvar_refs(node->rhs, iv) + count_lvar_refs(node->for_stmt, iv) != 1) {
+        node->for_update_expr = append_expr(node->for_update_expr, increments);
+        return;
+    }
+    // end = ptr + (bound - i) * size
+    LVar *ptr = vector_get(pointers, 0);
+    Node *count = new_node(ND_SUB, cond->rhs, new_node_lvar(iv));
+    count->expr_type = iv->type;
+    count = new_node_conv(count, &signed_long_type);
+    Node *size = new_node_num(type_sizeof(ptr->type->ptr_to));
+    size->expr_type = &signed_long_type;
+    Node *offset = new_node(ND_MUL, count, size);
+    offset->expr_type = &signed_long_type;
+    Node *end_addr = new_node(ND_ADD, new_node_lvar(ptr), offset);
+    end_addr->expr_type = ptr->type;
+    LVar *end = new_temp_lvar(ptr->type);
+    append_preheader(node, new_node_assignment(new_node_lvar(end), end_addr));
+
+    node->rhs = new_node(cond->kind, new_node_lvar(ptr), new_node_lvar(end));
+    node->rhs->expr_type = &signed_int_type;
+    node->for_update_expr = increments;
+}
+
+/// Vectorize ///
+
+// Vector registers available for element-wise expressions
+static const int vector_expr_regs = 9;
+static const int vector_max_loads = 6;
+static const int vector_max_scalars = 4;
+
+// Peels scopes and single statement compounds.
+static Node *single_stmt(Node *node) {
+    while(node) {
+        if(node->kind == ND_SCOPE) {
+            node = node->lhs;
+        }else if(node->kind == ND_COMPOUND && vector_size(node->compound_stmt_list) == 1) {
+            node = vector_get(node->compound_stmt_list, 0);
+        }else {
+            break;
+        }
+    }
+    return node;
+}
+
+// If node is a[iv] of an integer array with invariant a, returns the address of a.
+// Volatile elements are accessed one by one.
+static Node *iv_element_base(Node *node, LVar *iv, Vector *modified) {
+    if(node->kind != ND_DEREF || !type_is_int(node->expr_type) || node->expr_type->is_volatile) {
+        return NULL;
+    }
+    Node *addr = node->lhs;
+    if(addr->kind != ND_ADD || addr->expr_type == NULL || addr->expr_type->ty != PTR) {
+        return NULL;
+    }
+    if(addr->rhs->kind != ND_MUL || addr->rhs->rhs->kind != ND_NUM || addr->rhs->rhs->val != type_sizeof(node->expr_type)) {
+        return NULL;
+    }
+    Node *index = strip_convert(addr->rhs->lhs);
+    if(index->kind != ND_LVAR || index->lvar != iv || !is_invariant(addr->lhs, modified)) {
+        return NULL;
+    }
+    return addr->lhs;
+}
+
+static bool is_same_expr(Node *a, Node *b) {
+    if(a == NULL || b == NULL) {
+        return a == b;
+    }
+    if(a->kind != b->kind) {
+        return false;
+    }
+    if(a->expr_type && b->expr_type && !type_is_same(a->expr_type, b->expr_type)) {
+        return false;
+    }
+    switch(a->kind) {
+        case ND_NUM:
+            return a->val == b->val;
+        case ND_LVAR:
+            return a->lvar == b->lvar;
+        case ND_GVAR:
+            return a->gvar.gvar == b->gvar.gvar;
+        case ND_STRING_LITERAL:
+            return a->string_literal.literal == b->string_literal.literal;
+        case ND_CONVERT:
+        case ND_CAST:
+        case ND_DEREF:
+        case ND_ADDRESS_OF:
+        case ND_BIT_NOT:
+            return is_same_expr(a->lhs, b->lhs);
+        case ND_ADD:
+        case ND_SUB:
+        case ND_MUL:
+        case ND_DIV:
+        case ND_MOD:
+        case ND_AND:
+        case ND_OR:
+        case ND_XOR:
+        case ND_LSHIFT:
+        case ND_RSHIFT:
+            return is_same_expr(a->lhs, b->lhs) && is_same_expr(a->rhs, b->rhs);
+    }
+    return false;
+}
+
+static Node *new_vector_operand(Node *value, bool is_load) {
+    Node *node = new_node(ND_VECTOR_OPERAND, value, NULL);
+    node->expr_type = value->expr_type;
+    node->vector_operand.is_load = is_load;
+    return node;
+}
+
+// Translates node into element-wise operations on elem_size wide lanes.
+// Integer conversions are dropped because only the low bits of + - & | ^ ~ results are stored.
+static Node *vectorize_expr(Node *node, LVar *iv, int elem_size, Vector *modified) {
+    node = strip_convert(node);
+    if(!type_is_int(node->expr_type)) {
+        return NULL;
+    }
+    if(iv_element_base(node, iv, modified)) {
+        if(type_sizeof(node->expr_type) != elem_size) {
+            return NULL;
+        }
+        return new_vector_operand(node->lhs->lhs, true);
+    }
+    if(is_invariant(node, modified)) {
+        return new_vector_operand(node, false);
+    }
+    if(node->kind == ND_BIT_NOT) {
+        Node *lhs = vectorize_expr(node->lhs, iv, elem_size, modified);
+        if(!lhs) {
+            return NULL;
+        }
+        return new_node(ND_BIT_NOT, lhs, NULL);
+    }
+    if(node->kind != ND_ADD && node->kind != ND_SUB && node->kind != ND_AND && node->kind != ND_OR && node->kind != ND_XOR) {
+        return NULL;
+    }
+    Node *lhs = vectorize_expr(node->lhs, iv, elem_size, modified);
+    Node *rhs = vectorize_expr(node->rhs, iv, elem_size, modified);
+    if(lhs == NULL || rhs == NULL) {
+        return NULL;
+    }
+    return new_node(node->kind, lhs, rhs);
+}
+
+// Number of vector registers needed to evaluate node.
+static int vector_regs(Node *node) {
+    if(node->kind == ND_VECTOR_OPERAND) {
+        return 1;
+    }
+    int lhs = vector_regs(node->lhs);
+    int rhs = node->rhs ? vector_regs(node->rhs) + 1 : 2;
+    return lhs > rhs ? lhs : rhs;
+}
+
+static void count_vector_operands(Node *node, int *loads, int *scalars) {
+    if(node->kind == ND_VECTOR_OPERAND) {
+        if(node->vector_operand.is_load) {
+            (*loads)++;
+        }else {
+            (*scalars)++;
+        }
+        return;
+    }
+    count_vector_operands(node->lhs, loads, scalars);
+    if(node->rhs) {
+        count_vector_operands(node->rhs, loads, scalars);
+    }
+}
+
+// Whether lvar is a local accumulator of an integer type with size in sizes.
+static bool is_reduction_var(Node *node, LVar *iv) {
+    return node->kind == ND_LVAR && node->lvar != iv && type_is_int(node->expr_type)
+        && (type_sizeof(node->expr_type) == 4 || type_sizeof(node->expr_type) == 8)
+        && !vector_contains(address_taken_lvars, node->lvar);
+}
+
+// Recognizes the loop body. Returns NULL if it can not be vectorized.
+static VectorLoop *analyze_vector_body(Node *stmt, LVar *iv, Vector *modified) {
+    VectorLoop *vl = calloc(1, sizeof(VectorLoop));
+    if(stmt->kind == ND_ASSIGN && stmt->lhs->kind == ND_DEREF) {
+        // a[i] = expr
+        Node *dest = iv_element_base(stmt->lhs, iv, modified);
+        if(dest == NULL) {
+            return NULL;
+        }
+        vl->kind = VL_MAP;
+        vl->elem_size = type_sizeof(stmt->lhs->expr_type);
+        vl->dest = dest;
+        vl->expr = vectorize_expr(stmt->rhs, iv, vl->elem_size, modified);
+        if(!vl->expr) {
+            return NULL;
+        }
+        return vl;
+    }
+    if(stmt->kind == ND_ASSIGN && is_reduction_var(stmt->lhs, iv)) {
+        // s = s + expr
+        LVar *acc = stmt->lhs->lvar;
+        Node *sum = strip_convert(stmt->rhs);
+        if(sum->kind != ND_ADD) {
+            return NULL;
+        }
+        Node *value = NULL;
+        if(strip_convert(sum->lhs)->kind == ND_LVAR && strip_convert(sum->lhs)->lvar == acc) {
+            value = sum->rhs;
+        }else if(strip_convert(sum->rhs)->kind == ND_LVAR && strip_convert(sum->rhs)->lvar == acc) {
+            value = sum->lhs;
+        }
+        if(value == NULL || count_lvar_refs(value, acc) != 0) {
+            return NULL;
+        }
+        vl->acc = stmt->lhs;
+        Node *elem = strip_convert(value);
+        if(iv_element_base(elem, iv, modified) && type_sizeof(elem->expr_type) == 1 && !type_is_signed(elem->expr_type)) {
+            vl->kind = VL_SUM_BYTES;
+            vl->elem_size = 1;
+            vl->expr = new_vector_operand(elem->lhs->lhs, true);
+            return vl;
+        }
+        vl->kind = VL_SUM;
+        vl->elem_size = type_sizeof(stmt->lhs->expr_type);
+        vl->expr = vectorize_expr(value, iv, vl->elem_size, modified);
+        if(!vl->expr) {
+            return NULL;
+        }
+        return vl;
+    }
+    if(stmt->kind == ND_IF && stmt->else_stmt == NULL) {
+        // if(a[i] > m) m = a[i];
+        Node *cond = stmt->lhs;
+        Node *assign = single_stmt(stmt->rhs);
+        if(assign == NULL || assign->kind != ND_ASSIGN || !is_reduction_var(assign->lhs, iv)) {
+            return NULL;
+        }
+        if(cond->kind != ND_LESS && cond->kind != ND_LESS_OR_EQUAL && cond->kind != ND_GREATER && cond->kind != ND_GREATER_OR_EQUAL) {
+            return NULL;
+        }
+        LVar *acc = assign->lhs->lvar;
+        Node *elem = strip_convert(assign->rhs);
+        bool greater = cond->kind == ND_GREATER || cond->kind == ND_GREATER_OR_EQUAL;
+        if(cond->lhs->kind == ND_LVAR && cond->lhs->lvar == acc && is_same_expr(strip_convert(cond->rhs), elem)) {
+            // m < a[i]
+            greater = !greater;
+        }else if(!(cond->rhs->kind == ND_LVAR && cond->rhs->lvar == acc && is_same_expr(strip_convert(cond->lhs), elem))) {
+            return NULL;
+        }
+        if(type_sizeof(assign->lhs->expr_type) != 4 || !type_is_signed(assign->lhs->expr_type)
+                || !iv_element_base(elem, iv, modified) || type_sizeof(elem->expr_type) != 4 || !type_is_signed(elem->expr_type)) {
+            return NULL;
+        }
+        vl->kind = greater ? VL_MAX : VL_MIN;
+        vl->elem_size = 4;
+        vl->acc = assign->lhs;
+        vl->expr = new_vector_operand(elem->lhs->lhs, true);
+        return vl;
+    }
+    return NULL;
+}
+
+// Splits `for(init; i < n; i++) body` into a vector loop followed by the original loop for the remainder.
+static Node *vectorize_loop(Node *node) {
+    long step;
+    LVar *iv = basic_induction_var(node->for_update_expr, &step);
+    if(iv == NULL || step != 1 || vector_contains(address_taken_lvars, iv)) {
+        return node;
+    }
+    Node *cond = node->rhs;
+    if(cond == NULL || (cond->kind != ND_LESS && cond->kind != ND_NOT_EQUAL) || cond->lhs->kind != ND_LVAR || cond->lhs->lvar != iv) {
+        return node;
+    }
+    Node *stmt = single_stmt(node->for_stmt);
+    if(stmt == NULL) {
+        return node;
+    }
+    Vector *modified = new_vector();
+    collect_modified(node->rhs, modified);
+    collect_modified(node->for_update_expr, modified);
+    collect_modified(node->for_stmt, modified);
+    if(!type_is_same(cond->rhs->expr_type, iv->type) || !is_invariant(cond->rhs, modified)) {
+        return node;
+    }
+    VectorLoop *vl = analyze_vector_body(stmt, iv, modified);
+    if(vl == NULL) {
+        return node;
+    }
+    int loads = 0;
+    int scalars = 0;
+    count_vector_operands(vl->expr, &loads, &scalars);
+    if(vl->dest) {
+        loads++;
+    }
+    if(loads > vector_max_loads || scalars > vector_max_scalars || vector_regs(vl->expr) > vector_expr_regs) {
+        return node;
+    }
+    vl->iv = new_node_lvar(iv);
+    vl->bound = cond->rhs;
+    Node *vector_loop = new_node(ND_VECTOR_LOOP, node->lhs, node);
+    vector_loop->vector_loop = vl;
+    node->lhs = NULL;
+    return vector_loop;
+}
+
+/// Loop optimization ///
+
+// Moves invariant computations of the loop into a preheader.
+static Node *licm_loop(Node *node) {
+    Vector *modified = new_vector();
+    Vector *hoisted = new_vector();
+    if(node->kind == ND_FOR) {
+        collect_modified(node->rhs, modified);
+        collect_modified(node->for_update_expr, modified);
+        collect_modified(node->for_stmt, modified);
+        hoist_invariants(&node->rhs, modified, hoisted);
+        hoist_invariants(&node->for_update_expr, modified, hoisted);
+        hoist_invariants(&node->for_stmt, modified, hoisted);
+        // Preheader is evaluated after clause-1
+        for(int i = 0; i < vector_size(hoisted); i++) {
+            append_preheader(node, vector_get(hoisted, i));
+        }
+        return node;
+    }
+    collect_modified(node->lhs, modified);
+    collect_modified(node->rhs, modified);
+    hoist_invariants(&node->lhs, modified, hoisted);
+    hoist_invariants(&node->rhs, modified, hoisted);
+    if(vector_size(hoisted) == 0) {
+        return node;
+    }
+    Node *compound = new_node(ND_COMPOUND, NULL, NULL);
+    compound->compound_stmt_list = hoisted;
+    vector_push(compound->compound_stmt_list, node);
+    return compound;
+}
+
+static Node *licm_walk(Node *node) {
+    if(node == NULL) {
+        return NULL;
+    }
+    Vector *slots = new_vector();
+    child_slots(node, slots);
+    for(int i = 0; i < vector_size(slots); i++) {
+        Node **slot = vector_get(slots, i);
+        *slot = licm_walk(*slot);
+    }
+    if(node->kind == ND_FOR) {
+        // The scalar loop is optimized also when it is left as the remainder of a vector loop.
+        Node *loop = vectorize_loop(node);
+        optimize_induction(node);
+        licm_loop(node);
+        return loop;
+    }
+    if(node->kind == ND_WHILE || node->kind == ND_DO) {
+        return licm_loop(node);
+    }
+    return node;
+}
+
+/// Common subexpression elimination ///
+
+// A computed expression which may be reused by later evaluations of the same expression.
+struct CseEntry {
+    Node *expr;
+    Node **first_slot;
+    Vector *later_slots;
+    bool reads_memory;
+    Vector *read_lvars; // locals whose stores kill the entry
+    bool killed;
+};
+
+// Entries of the current function, in order of the first occurrence.
+static Vector *cse_entries;
+// Entries not killed yet. Stores only scan these.
+static Vector *cse_live_entries;
+// lvalues already visited. Compound assignments share the lvalue node with the operand.
+static Vector *cse_lvalues;
+
+// Whether node only computes a value from locals, globals and memory.
+// Reads of volatile objects must be repeated, so expressions containing them are not pure.
+// This also keeps them out of CSE and store-to-load forwarding.
+static bool is_pure_expr(Node *node) {
+    switch(node->kind) {
+        case ND_NUM:
+        case ND_STRING_LITERAL:
+            return true;
+        case ND_LVAR:
+            return !node->lvar->is_volatile;
+        case ND_GVAR:
+            return !node->gvar.gvar->is_volatile;
+        case ND_DEREF:
+            return !node->expr_type->is_volatile && is_pure_expr(node->lhs);
+        case ND_ADDRESS_OF:
+        case ND_CONVERT:
+        case ND_CAST:
+        case ND_BIT_NOT:
+            return is_pure_expr(node->lhs);
+        case ND_ADD:
+        case ND_SUB:
+        case ND_MUL:
+        case ND_DIV:
+        case ND_MOD:
+        case ND_AND:
+        case ND_OR:
+        case ND_XOR:
+        case ND_LSHIFT:
+        case ND_RSHIFT:
+            return is_pure_expr(node->lhs) && is_pure_expr(node->rhs);
+    }
+    return false;
+}
+
+// Rough number of instructions to recompute node.
+static int expr_cost(Node *node) {
+    if(node == NULL) {
+        return 0;
+    }
+    int cost = 0;
+    if(node->kind == ND_DEREF) {
+        cost = 2;
+    }else if(node->kind == ND_LVAR || node->kind == ND_GVAR) {
+        cost = node->expr_type->ty == ARRAY ? 0 : 1;
+    }else if(node->kind != ND_NUM && node->kind != ND_CONVERT && node->kind != ND_CAST && node->kind != ND_ADDRESS_OF) {
+        cost = 1;
+    }
+    if(node->kind == ND_ADDRESS_OF) {
+        return cost;
+    }
+    return cost + expr_cost(node->lhs) + expr_cost(node->rhs);
+}
+
+// Also decides store-to-load forwarding, which is not done for volatile lvalues.
+static bool is_cse_candidate(Node *node) {
+    if(node->expr_type == NULL || !type_is_scalar(node->expr_type) || type_sizeof(node->expr_type) > 8) {
+        return false;
+    }
+    if(node->expr_type->is_volatile) {
+        return false;
+    }
+    switch(node->kind) {
+        case ND_GVAR:
+            // Repeated loads of variables in memory. Other locals are kept in registers.
+            return !node->gvar.gvar->is_volatile;
+        case ND_LVAR:
+            return !node->lvar->is_volatile && vector_contains(address_taken_lvars, node->lvar);
+        case ND_DEREF:
+        case ND_ADD:
+        case ND_SUB:
+        case ND_MUL:
+        case ND_DIV:
+        case ND_MOD:
+        case ND_AND:
+        case ND_OR:
+        case ND_XOR:
+        case ND_LSHIFT:
+        case ND_RSHIFT:
+            return is_pure_expr(node) && expr_cost(node) >= 3;
+    }
+    return false;
+}
+
+// Whether evaluation of node loads memory which may be changed by stores through pointers or calls.
+static bool reads_memory(Node *node) {
+    if(node == NULL) {
+        return false;
+    }
+    if(node->kind == ND_DEREF && node->expr_type->ty != ARRAY) {
+        return true;
+    }
+    if(node->kind == ND_GVAR && node->expr_type->ty != ARRAY) {
+        return true;
+    }
+    if(node->kind == ND_LVAR && node->expr_type->ty != ARRAY && vector_contains(address_taken_lvars, node->lvar)) {
+        return true;
+    }
+    if(node->kind == ND_ADDRESS_OF) {
+        return false;
+    }
+    return reads_memory(node->lhs) || reads_memory(node->rhs);
+}
+
+// Collects the locals read by the pure expression node.
+static void collect_read_lvars(Node *node, Vector *lvars) {
+    if(node == NULL) {
+        return;
+    }
+    if(node->kind == ND_LVAR && !vector_contains(lvars, node->lvar)) {
+        vector_push(lvars, node->lvar);
+    }
+    collect_read_lvars(node->lhs, lvars);
+    collect_read_lvars(node->rhs, lvars);
+}
+
+// Removes killed entries from entries, keeping the order of the others.
+static void cse_drop_killed(Vector *entries) {
+    int size = 0;
+    for(int i = 0; i < vector_size(entries); i++) {
+        CseEntry *entry = vector_get(entries, i);
+        if(!entry->killed) {
+            vector_set(entries, size, entry);
+            size++;
+        }
+    }
+    while(vector_size(entries) > size) {
+        vector_pop(entries);
+    }
+}
+
+static CseEntry *find_available(Vector *available, Node *node) {
+    cse_drop_killed(available);
+    for(int i = 0; i < vector_size(available); i++) {
+        CseEntry *entry = vector_get(available, i);
+        if(is_same_expr(entry->expr, node)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static void cse_kill_memory() {
+    for(int i = 0; i < vector_size(cse_live_entries); i++) {
+        CseEntry *entry = vector_get(cse_live_entries, i);
+        if(entry->reads_memory) {
+            entry->killed = true;
+        }
+    }
+    cse_drop_killed(cse_live_entries);
+}
+
+static void cse_kill_all() {
+    for(int i = 0; i < vector_size(cse_live_entries); i++) {
+        CseEntry *entry = vector_get(cse_live_entries, i);
+        entry->killed = true;
+    }
+    cse_drop_killed(cse_live_entries);
+}
+
+// Kills entries depending on the value stored to lvalue.
+static void cse_kill_store(Node *lvalue) {
+    if(lvalue->kind != ND_LVAR || vector_contains(address_taken_lvars, lvalue->lvar)) {
+        cse_kill_memory();
+        return;
+    }
+    for(int i = 0; i < vector_size(cse_live_entries); i++) {
+        CseEntry *entry = vector_get(cse_live_entries, i);
+        if(vector_contains(entry->read_lvars, lvalue->lvar)) {
+            entry->killed = true;
+        }
+    }
+    cse_drop_killed(cse_live_entries);
+}
+
+static Vector *cse_walk(Node **slot, Vector *available);
+
+// expr is computed by the node at first_slot, which is the stored value for store-to-load forwarding.
+static CseEntry *new_cse_entry(Node *expr, Node **first_slot) {
+    CseEntry *entry = calloc(1, sizeof(CseEntry));
+    entry->expr = expr;
+    entry->first_slot = first_slot;
+    entry->later_slots = new_vector();
+    entry->reads_memory = reads_memory(expr);
+    entry->read_lvars = new_vector();
+    collect_read_lvars(expr, entry->read_lvars);
+    vector_push(cse_entries, entry);
+    vector_push(cse_live_entries, entry);
+    return entry;
+}
+
+static void cse_lvalue(Node *node, Vector *available) {
+    vector_push(cse_lvalues, node);
+    if(node->kind == ND_DEREF) {
+        cse_walk(&node->lhs, available);
+    }
+}
+
+// Walks *slot in evaluation order, recording computed expressions in available.
+// Control flow joins discard what was computed on only some paths. Returns the expressions available afterwards.
+static Vector *cse_walk(Node **slot, Vector *available) {
+    Node *node = *slot;
+    if(node == NULL) {
+        return available;
+    }
+    if(node->kind == ND_DEREF && vector_contains(cse_lvalues, node)) {
+        return available;
+    }
+    bool is_candidate = is_cse_candidate(node);
+    if(is_candidate) {
+        CseEntry *entry = find_available(available, node);
+        if(entry) {
+            vector_push(entry->later_slots, slot);
+            return available;
+        }
+    }
+    switch(node->kind) {
+        case ND_ASSIGN:
+            cse_lvalue(node->lhs, available);
+            available = cse_walk(&node->rhs, available);
+            cse_kill_store(node->lhs);
+            if(is_cse_candidate(node->lhs)) {
+                // Store-to-load forwarding: later loads of the lvalue reuse the stored value.
+                vector_push(available, new_cse_entry(node->lhs, &node->rhs));
+            }
+            return available;
+        case ND_POSTFIX_INC:
+        case ND_POSTFIX_DEC:
+        case ND_PREFIX_INC:
+        case ND_PREFIX_DEC:
+            cse_lvalue(node->lhs, available);
+            cse_kill_store(node->lhs);
+            return available;
+        case ND_ADDRESS_OF:
+            cse_lvalue(node->lhs, available);
+            return available;
+        case ND_DECL_VAR:
+            available = cse_walk(&node->rhs, available);
+            cse_kill_store(new_node_lvar(node->decl_var.lvar));
+            return available;
+        case ND_CALL:
+            for(NodeList *cur = node->call_arg_list.next; cur; cur = cur->next) {
+                available = cse_walk(&cur->node, available);
+            }
+            cse_kill_memory();
+            return available;
+        case ND_MEMZERO:
+            cse_kill_memory();
+            return available;
+        case ND_IF: {
+            available = cse_walk(&node->lhs, available);
+            cse_walk(&node->rhs, vector_dup(available));
+            cse_walk(&node->else_stmt, vector_dup(available));
+            return available;
+        }
+        case ND_SWITCH:
+            available = cse_walk(&node->lhs, available);
+            cse_walk(&node->rhs, new_vector());
+            return new_vector();
+        case ND_CASE:
+        case ND_DEFAULT:
+            // jump target
+            cse_walk(&node->lhs, new_vector());
+            return new_vector();
+        case ND_FOR:
+            available = cse_walk(&node->lhs, available);
+            cse_walk(&node->rhs, new_vector());
+            cse_walk(&node->for_stmt, new_vector());
+            cse_walk(&node->for_update_expr, new_vector());
+            return new_vector();
+        case ND_WHILE:
+        case ND_DO:
+            cse_walk(&node->lhs, new_vector());
+            cse_walk(&node->rhs, new_vector());
+            return new_vector();
+        case ND_RETURN:
+        case ND_BREAK:
+        case ND_CONTINUE:
+            cse_walk(&node->lhs, available);
+            return new_vector();
+        case ND_INLINE:
+        case ND_VECTOR_LOOP:
+            cse_kill_all();
+            cse_walk(&node->lhs, new_vector());
+            cse_walk(&node->rhs, new_vector());
+            cse_kill_all();
+            return new_vector();
+    }
+    Vector *slots = new_vector();
+    child_slots(node, slots);
+    for(int i = 0; i < vector_size(slots); i++) {
+        available = cse_walk(vector_get(slots, i), available);
+    }
+    if(is_candidate) {
+        vector_push(available, new_cse_entry(node, slot));
+    }
+    return available;
+}
+
+// Saves reused expressions to temporaries at their first evaluation and loads them at later ones.
+static void eliminate_common_subexprs(Node *func) {
+    cse_entries = new_vector();
+    cse_live_entries = new_vector();
+    cse_lvalues = new_vector();
+    cse_walk(&func->lhs, new_vector());
+    for(int i = 0; i < vector_size(cse_entries); i++) {
+        CseEntry *entry = vector_get(cse_entries, i);
+        if(vector_size(entry->later_slots) == 0) {
+            continue;
+        }
+        LVar *tmp = new_temp_lvar(entry->expr->expr_type);
+        *entry->first_slot = new_node_assignment(new_node_lvar(tmp), *entry->first_slot);
+        for(int j = 0; j < vector_size(entry->later_slots); j++) {
+            Node **slot = vector_get(entry->later_slots, j);
+            *slot = new_node_lvar(tmp);
+        }
+    }
+}
+
+/// Tail calls ///
+
+// Whether addresses of locals may outlive the statement computing them.
+static bool frame_escapes(Node *node) {
+    if(node == NULL) {
+        return false;
+    }
+    if(node->kind == ND_ADDRESS_OF && node->lhs->kind == ND_LVAR) {
+        return true;
+    }
+    if(node->kind == ND_LVAR && node->expr_type->ty == ARRAY) {
+        return true;
+    }
+    Vector *slots = new_vector();
+    child_slots(node, slots);
+    for(int i = 0; i < vector_size(slots); i++) {
+        Node **slot = vector_get(slots, i);
+        if(frame_escapes(*slot)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Marks calls whose result is returned as is, also from a returned inlined body.
+// Codegen replaces them with a jump after tearing down the frame.
+static void mark_tail_calls(Node *node) {
+    if(node == NULL || node->kind == ND_INLINE) {
+        return;
+    }
+    if(node->kind == ND_RETURN && node->lhs && node->lhs->kind == ND_CALL) {
+        Node *call = node->lhs;
+        int nargs = 0;
+        for(NodeList *cur = call->call_arg_list.next; cur; cur = cur->next) {
+            nargs++;
+        }
+        // Arguments on the stack would overwrite the caller's frame.
+        if(nargs <= 6 && !(call->lhs && call->lhs->kind == ND_GVAR && call->lhs->gvar.gvar->is_builtin)) {
+            call->is_tail_call = true;
+        }
+        return;
+    }
+    if(node->kind == ND_RETURN && node->lhs && node->lhs->kind == ND_INLINE) {
+        mark_tail_calls(node->lhs->rhs);
+        return;
+    }
+    Vector *slots = new_vector();
+    child_slots(node, slots);
+    for(int i = 0; i < vector_size(slots); i++) {
+        Node **slot = vector_get(slots, i);
+        mark_tail_calls(*slot);
+    }
+}
+
+/// Register variables ///
+
+// rbx, r12, r13 and r14
+static const int reg_var_max = 4;
+// r10 and r11, which are not touched by the body unless it calls or vectorizes
+static const int leaf_reg_var_max = 2;
+
+// Whether node calls a function other than by a tail call, or runs a vector loop.
+static bool clobbers_scratch_regs(Node *node) {
+    if(node == NULL) {
+        return false;
+    }
+    if(node->kind == ND_VECTOR_LOOP) {
+        return true;
+    }
+    if(node->kind == ND_CALL && !node->is_tail_call
+            && !(node->lhs && node->lhs->kind == ND_GVAR && node->lhs->gvar.gvar->is_builtin)) {
+        return true;
+    }
+    Vector *slots = new_vector();
+    child_slots(node, slots);
+    for(int i = 0; i < vector_size(slots); i++) {
+        Node **slot = vector_get(slots, i);
+        if(clobbers_scratch_regs(*slot)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Register candidates are weighted by their uses, a use in a loop counting 8 times more than outside.
+static const int reg_weight_max_depth = 6;
+
+static bool is_reg_candidate(LVar *lvar) {
+    return type_is_scalar(lvar->type) && type_sizeof(lvar->type) <= 8 && !lvar->is_volatile
+        && !vector_contains(address_taken_lvars, lvar);
+}
+
+static void add_reg_candidate(Vector *lvars, Vector *weights, LVar *lvar, long weight) {
+    if(!is_reg_candidate(lvar)) {
+        return;
+    }
+    for(int i = 0; i < vector_size(lvars); i++) {
+        if(vector_get(lvars, i) == lvar) {
+            vector_set(weights, i, (void*)((long)vector_get(weights, i) + weight));
+            return;
+        }
+    }
+    vector_push(lvars, lvar);
+    vector_push(weights, (void*)weight);
+}
+
+static void collect_reg_candidates(Node *node, int depth, Vector *lvars, Vector *weights) {
+    if(node == NULL) {
+        return;
+    }
+    if(node->kind == ND_LVAR) {
+        add_reg_candidate(lvars, weights, node->lvar, 1L << 3 * (depth < reg_weight_max_depth ? depth : reg_weight_max_depth));
+    }else if(node->kind == ND_DECL_VAR) {
+        add_reg_candidate(lvars, weights, node->decl_var.lvar, 0);
+    }
+    if(node->kind == ND_FOR || node->kind == ND_WHILE || node->kind == ND_DO || node->kind == ND_VECTOR_LOOP) {
+        depth++;
+    }
+    Vector *slots = new_vector();
+    child_slots(node, slots);
+    for(int i = 0; i < vector_size(slots); i++) {
+        Node **slot = vector_get(slots, i);
+        collect_reg_candidates(*slot, depth, lvars, weights);
+    }
+}
+
+// Keeps scalar arguments and locals whose address is never taken in registers instead of the frame,
+// the most used first. Leaf functions use scratch registers first, which need not be saved.
+static void assign_registers(Node *func) {
+    if(func->func_def.type->is_vararg) {
+        return;
+    }
+    Vector *lvars = new_vector();
+    Vector *weights = new_vector();
+    for(int i = 0; i < vector_size(func->func_def.arg_vec); i++) {
+        FuncDefArg *arg = vector_get(func->func_def.arg_vec, i);
+        add_reg_candidate(lvars, weights, arg->lvar, 1);
+    }
+    collect_reg_candidates(func->lhs, 0, lvars, weights);
+
+    // Profiling hooks of instrumented functions clobber scratch registers.
+    int leaf_reg = clobbers_scratch_regs(func->lhs) || is_instrumented(func) ? leaf_reg_var_max : 0;
+    int reg = 0;
+    while(vector_size(lvars) && (leaf_reg < leaf_reg_var_max || reg < reg_var_max)) {
+        int best = 0;
+        for(int i = 1; i < vector_size(lvars); i++) {
+            if((long)vector_get(weights, best) < (long)vector_get(weights, i)) {
+                best = i;
+            }
+        }
+        LVar *lvar = vector_get(lvars, best);
+        if(leaf_reg < leaf_reg_var_max) {
+            lvar->reg = reg_var_max + ++leaf_reg;
+        }else {
+            lvar->reg = ++reg;
+        }
+        vector_set(lvars, best, vector_last(lvars));
+        vector_set(weights, best, vector_last(weights));
+        vector_pop(lvars);
+        vector_pop(weights);
+    }
+    func->func_def.saved_regs = reg;
+}
+
+// Finds what the prologue has to set up for func.
+static void collect_frame_usage(Node *node, Node *func) {
+    if(node == NULL) {
+        return;
+    }
+    if(node->kind == ND_LVAR && node->lvar->reg == 0) {
+        func->func_def.uses_frame = true;
+    }else if(node->kind == ND_DECL_VAR && node->decl_var.lvar->reg == 0) {
+        func->func_def.uses_frame = true;
+    }
+    Vector *slots = new_vector();
+    child_slots(node, slots);
+    for(int i = 0; i < vector_size(slots); i++) {
+        Node **slot = vector_get(slots, i);
+        collect_frame_usage(*slot, func);
+    }
+}
+
+/// Driver ///
+
+// Whether func calls the profiling hooks of -finstrument-functions on entry and exit.
+// Instrumented functions are not inlined so that every call is reported.
+bool is_instrumented(Node *func) {
+    return opt_instrument_functions && !func->func_def.no_instrument;
+}
+
+static void optimize_function(Node *func) {
+    current_func_def = func;
+    if(!opt_no_inline) {
+        func->lhs = inline_walk(func->lhs);
+    }
+    func->lhs = canonicalize_lvar_access(func->lhs);
+    address_taken_lvars = new_vector();
+    collect_address_taken(func->lhs);
+    func->lhs = licm_walk(func->lhs);
+    eliminate_common_subexprs(func);
+    // The exit hook must run before returning, so instrumented functions have no tail calls.
+    if(!opt_no_sibling_calls && !is_instrumented(func) && !frame_escapes(func->lhs)) {
+        mark_tail_calls(func->lhs);
+    }
+    assign_registers(func);
+    collect_frame_usage(func->lhs, func);
+    if(func->func_def.type->is_vararg) {
+        func->func_def.uses_frame = true;
+    }
+}
+
+void optimize(Node *trans_unit) {
+    func_defs = new_vector();
+    inline_stack = new_vector();
+    Vector *decls = trans_unit->trans_unit.decl;
+    for(int i = 0; i < vector_size(decls); i++) {
+        Node *decl = vector_get(decls, i);
+        if(decl->kind == ND_FUNC_DEF) {
+            vector_push(func_defs, decl);
+        }
+    }
+    for(int i = 0; i < vector_size(func_defs); i++) {
+        optimize_function(vector_get(func_defs, i));
+    }
+}
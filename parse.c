@@ -13,6 +13,7 @@ int max_stack_size;
 Vector *globals;
 int global_size;
 Vector *global_string_literals;
+Vector *init_templates;
 Vector *struct_registry;
 Vector *union_registry;
 Vector *enum_registry;
@@ -82,6 +83,10 @@ char *node_kind(NodeKind kind){
         case ND_DO: return "ND_DO";
         case ND_COMPOUND: return "ND_COMPOUND";
         case ND_CALL: return "ND_CALL";
+        case ND_INLINE: return "ND_INLINE";
+        case ND_VECTOR_LOOP: return "ND_VECTOR_LOOP";
+        case ND_VECTOR_OPERAND: return "ND_VECTOR_OPERAND";
+        case ND_MEMZERO: return "ND_MEMZERO";
         case ND_POSTFIX_INC: return "ND_POSTFIX_INC";
         case ND_POSTFIX_DEC: return "ND_POSTFIX_DEC";
         case ND_PREFIX_INC: return "ND_PREFIX_INC";
@@ -90,6 +95,7 @@ char *node_kind(NodeKind kind){
         case ND_FUNC_DECL: return "ND_FUNC_DECL";
         case ND_SCOPE: return "ND_SCOPE";
         case ND_DECL_LIST: return "ND_DECL_LIST";
+        case ND_DECL_LIST_LOCAL: return "ND_DECL_LIST_LOCAL";
         case ND_ADDRESS_OF: return "ND_ADDRESS_OF";
         case ND_DEREF: return "ND_DEREF";
         case ND_BIT_NOT: return "ND_BIT_NOT";
@@ -187,6 +193,16 @@ Node *new_node(NodeKind kind, Node *lhs, Node *rhs){
 
 Node *new_node_ptr_offset(NodeKind kind, Node *lhs, Node *rhs) {
     Type *t = lhs->expr_type->ptr_to;
+    if(rhs->kind == ND_NUM) {
+        // Constant index: fold the scale factor
+        Node *offset_node = new_node_num(rhs->val * type_sizeof(t));
+        offset_node->expr_type = &signed_long_type;
+        lhs = new_node(ND_CONVERT, lhs, NULL);
+        lhs->expr_type = type_new_ptr(&void_type);
+        Node *node = new_node(kind, lhs, offset_node);
+        node->expr_type = type_new_ptr(t);
+        return node;
+    }
     // First, convert integer to long (have the same size as pointer)
     rhs = new_node_conv(rhs, &signed_long_type);
 
@@ -436,6 +452,7 @@ Type* create_va_list_struct() {
     va_list_struct->members = new_vector();
     va_list_struct->struct_complete = true;
     va_list_struct->struct_size = 24;
+    va_list_struct->struct_align = 8;
 
     vector_push(va_list_struct->members, create_struct_member(&unsigned_int_type, "gp_offset", 0));
     vector_push(va_list_struct->members, create_struct_member(&unsigned_int_type, "fp_offset", 4));
@@ -454,6 +471,12 @@ void define_builtins() {
     args = new_vector();
     define_builtin_one("__builtin_va_end", type_new_func(&void_type, args, false));
 
+    // __builtin_expect(exp, c) returns exp and hints that it equals c.
+    args = new_vector();
+    vector_push(args, &signed_long_type);
+    vector_push(args, &signed_long_type);
+    define_builtin_one("__builtin_expect", type_new_func(&signed_long_type, args, false));
+
     TypedefRegistryEntry *entry = calloc(1, sizeof(TypedefRegistryEntry));
     entry->ident = "__builtin_va_list";
     entry->ident_len = strlen(entry->ident);
@@ -466,6 +489,7 @@ Node *translation_unit() {
     globals = new_vector();
     global_size = 0;
     global_string_literals = new_vector();
+    init_templates = new_vector();
     struct_registry = new_vector();
     union_registry = new_vector();
     enum_registry = new_vector();
@@ -552,6 +576,7 @@ Node *function_definition(TypeStorage type_storage, Node *type_node, bool is_inl
         if(find_lvar_one(scope->scope.locals, arg->ident, arg->ident_len)) {
             error_at(token->str, "Arguments with same name are defined: %.*s", arg->ident_len, arg->ident);
         }
+        align_locals(scope, arg_type, 0);
         arg->lvar = new_lvar(scope->scope.locals, arg->ident, arg->ident_len);
         arg->lvar->func_arg_index = i + 1;
         arg->lvar->type = arg_type;
@@ -582,7 +607,7 @@ Node *function_definition(TypeStorage type_storage, Node *type_node, bool is_inl
     return node;
 }
 
-Node *variable_definition(bool is_global, Node *type_node, TypeStorage type_storage) {
+Node *variable_definition(bool is_global, Node *type_node, TypeStorage type_storage, bool is_const) {
     Type *type = type_node->type.type;
     Node *node = new_node(is_global ? ND_GVAR_DEF : ND_DECL_VAR, type_node, NULL);
 
@@ -598,7 +623,9 @@ Node *variable_definition(bool is_global, Node *type_node, TypeStorage type_stor
             error("extern variable cannot have initializer");
         }
         init_expr = initializer(type);
-        if((init_expr->kind == ND_INIT) != (type->ty == ARRAY || type->ty == STRUCT)) {
+        // Local struct can be initialized by a struct value.
+        bool is_struct_copy = !is_global && type->ty == STRUCT && init_expr->kind != ND_INIT && type_is_same(type, init_expr->expr_type);
+        if((init_expr->kind == ND_INIT) != (type->ty == ARRAY || type->ty == STRUCT) && !is_struct_copy) {
             error_at(token->str, "Initializer type does not match");
         }
     }
@@ -610,6 +637,9 @@ Node *variable_definition(bool is_global, Node *type_node, TypeStorage type_stor
             error("No identifier on extern variable");
         }
         global_variable_definition(node, ident, ident_len, false);
+        if(type_node->type.is_volatile) {
+            node->gvar_def.gvar->is_volatile = true;
+        }
 
         return new_node(ND_TYPE_EXTERN, node, NULL);
     }
@@ -628,6 +658,18 @@ Node *variable_definition(bool is_global, Node *type_node, TypeStorage type_stor
             if(cur->kind == ND_IDENT) {
                 found = true;
                 global_variable_definition(node, cur->ident.ident, cur->ident.ident_len, true);
+                GVar *gvar = node->gvar_def.gvar;
+                gvar->is_static = type_storage == TS_STATIC;
+                gvar->align = type_node->type.align;
+                // const applies to the object itself only when it is not a pointer (or array of them).
+                Type *object_type = type;
+                while(object_type->ty == ARRAY) {
+                    object_type = object_type->ptr_to;
+                }
+                gvar->is_const = is_const && object_type->ty != PTR;
+                if(type_node->type.is_volatile) {
+                    gvar->is_volatile = true;
+                }
                 break;
             }
         }
@@ -693,16 +735,36 @@ Node *local_variable_definition() {
         if(find_lvar_one(scope->scope.locals, ident, ident_len) != NULL){
             error("variable with same name is already defined.");
         }
+        align_locals(scope, type_node->type.type, type_node->type.align);
         node->decl_var.lvar = new_lvar(scope->scope.locals, ident, ident_len);
         node->decl_var.lvar->type = type_node->type.type;
+        node->decl_var.lvar->is_volatile = type_node->type.is_volatile;
         int size = type_sizeof(node->decl_var.lvar->type);
         scope->scope.current += size;
         locals_stack_size += size;
 
         Type *type = node->decl_var.lvar->type;
         Node *init_expr = node->decl_var.init_expr;
-        if(init_expr) {
-            Node *lvar_init_node = lvar_initializer_node(node->decl_var.lvar, 0, init_expr, type);
+        Node *template_init = NULL;
+        if(init_expr && init_expr->kind == ND_INIT && !type_is_scalar(type)) {
+            Node *constant_init = constant_initializer(init_expr, type);
+            if(constant_init) {
+                template_init = lvar_template_initializer_node(node->decl_var.lvar, constant_init, type);
+            }
+        }
+        if(template_init) {
+            node->rhs = template_init;
+        }else if(init_expr && init_expr->kind == ND_INIT && !type_is_scalar(type) && !initializer_is_complete(init_expr, type)) {
+            // Fill the whole object with zero at once, then store explicitly initialized elements.
+            Node *zero_node = new_node(ND_MEMZERO, new_node_lvar(node->decl_var.lvar), NULL);
+            zero_node->expr_type = type;
+            Node *init_code_node = new_node(ND_COMPOUND, NULL, NULL);
+            init_code_node->compound_stmt_list = new_vector();
+            vector_push(init_code_node->compound_stmt_list, zero_node);
+            vector_push(init_code_node->compound_stmt_list, lvar_initializer_node(node->decl_var.lvar, 0, init_expr, type, true));
+            node->rhs = init_code_node;
+        }else if(init_expr) {
+            Node *lvar_init_node = lvar_initializer_node(node->decl_var.lvar, 0, init_expr, type, false);
             node->rhs = lvar_init_node;
         }
         vector_push(decl_list_local->decl_list_local.decls, node);
@@ -1017,7 +1079,7 @@ Node *logical_OR_expression() {
 
     while(consume("||")) {
         Node *cond = new_node(ND_EQUAL, node, new_node_num(0));
-        node = new_node(ND_IF, cond, logical_AND_expression());
+        node = new_node(ND_IF, cond, new_node_binop(ND_NOT_EQUAL, logical_AND_expression(), new_node_num(0)));
         node->expr_type = &signed_int_type;
         node->else_stmt = new_node_num(1);
     }
@@ -1030,7 +1092,8 @@ Node *logical_AND_expression() {
 
     while(1) {
         if(consume("&&")) {
-            node = new_node(ND_IF, node, inclusive_OR_expression());
+            // Right operand is normalized to 0 or 1
+            node = new_node(ND_IF, node, new_node_binop(ND_NOT_EQUAL, inclusive_OR_expression(), new_node_num(0)));
             node->expr_type = &signed_int_type;
             node->else_stmt = new_node_num(0);
         } else {
@@ -1384,8 +1447,7 @@ Node *primary_expression() {
         literal->len = token->len;
         literal->char_vec = token->literal;
         literal->vec_len = token->literal_len;
-        literal->index = vector_size(global_string_literals);
-        vector_push(global_string_literals, literal);
+        literal = intern_string_literal(literal);
         next_token();
 
         node = new_node(ND_STRING_LITERAL, NULL, NULL);
@@ -1508,11 +1570,20 @@ Node *type_(bool need_ident, bool is_global, bool parse_one_type) {
     int ident_len;
     Type *base_type = NULL;
     int tk_count[TK_MAX] = {};
+    int decl_align = 0;
+    attribute_no_instrument = false;
+    attribute_noreturn = false;
     while(1) {
         TokenKind kind;
         if(!consume_type_prefix(&kind)) {
             break;
         }
+        if(kind == TK_ALIGNAS || kind == TK_ATTRIBUTE) {
+            int align = alignment_specifier(kind);
+            if(decl_align < align) {
+                decl_align = align;
+            }
+        }
         if(kind == TK_STRUCT) {
             base_type = struct_declaration(true)->type.type;
         } else if(kind == TK_UNION) {
@@ -1661,8 +1732,17 @@ Node *type_(bool need_ident, bool is_global, bool parse_one_type) {
     if(base_type == NULL) {
         error_at(token->str, "Cannot parse type specifier");
     }
+    if(tk_count[TK_VOLATILE] && type_is_scalar(base_type)) {
+        // Accesses of the object through pointers must not be widened or merged.
+        Type *volatile_type = calloc(1, sizeof(Type));
+        memcpy(volatile_type, base_type, sizeof(Type));
+        volatile_type->is_volatile = true;
+        base_type = volatile_type;
+    }
 
     bool is_inline = tk_count[TK_INLINE];
+    bool spec_no_instrument = attribute_no_instrument;
+    bool spec_noreturn = attribute_noreturn || tk_count[TK_NORETURN];
 
     Node *list_node = new_node(ND_DECL_LIST, NULL, NULL);
     list_node->decl_list.base_type = base_type;
@@ -1674,12 +1754,22 @@ Node *type_(bool need_ident, bool is_global, bool parse_one_type) {
     while(!at_eof()) {
         Type *cur = base_type;
         Node *node = new_node(ND_TYPE, type_pointer(need_ident), NULL);
+        node->type.align = decl_align;
+        attribute_no_instrument = spec_no_instrument;
+        attribute_noreturn = spec_noreturn;
+        while(consume_kind(TK_ATTRIBUTE)) {
+            int align = alignment_specifier(TK_ATTRIBUTE);
+            if(node->type.align < align) {
+                node->type.align = align;
+            }
+        }
         Node *node_cur = node;
         for(; node_cur; node_cur = node_cur->lhs) {
             if(node_cur->kind == ND_IDENT) {
                 break;
             } else if(node_cur->kind == ND_TYPE_POINTER) {
                 cur = type_new_ptr(cur);
+                cur->is_volatile = node_cur->type.is_volatile;
             } else if(node_cur->kind == ND_TYPE_ARRAY) {
                 cur = type_new_array(cur, node_cur->type.array.has_size, node_cur->type.array.size);
             } else if(node_cur->kind == ND_TYPE_FUNC) {
@@ -1688,6 +1778,8 @@ Node *type_(bool need_ident, bool is_global, bool parse_one_type) {
             node_cur->type.type = cur;
         }
         node->type.type = cur;
+        // In `volatile int *p` the qualifier belongs to the pointer target, not to p.
+        node->type.is_volatile = cur->is_volatile || (tk_count[TK_VOLATILE] > 0 && !type_is_scalar(cur));
         if(peek("{")) {
             if(cur->ty != FUNC) {
                 error_at(token->str, "Non function type cannot have function body");
@@ -1696,7 +1788,16 @@ Node *type_(bool need_ident, bool is_global, bool parse_one_type) {
                 error_at(token->str, "typedef cannot have function body");
             }
             // function definition
-            return function_definition(type_storage, node, is_inline);
+            bool no_instrument = attribute_no_instrument;
+            bool noreturn = attribute_noreturn;
+            Node *func = function_definition(type_storage, node, is_inline);
+            // The attribute may be given on an earlier declaration.
+            GVar *decl = find_gvar(globals, func->func_def.ident, func->func_def.ident_len);
+            func->func_def.no_instrument = no_instrument || decl->no_instrument;
+            if(noreturn) {
+                decl->is_noreturn = true;
+            }
+            return func;
         }
         // declaration
         Node *var_node;
@@ -1710,10 +1811,16 @@ Node *type_(bool need_ident, bool is_global, bool parse_one_type) {
             if(gvar == NULL) {
                 gvar = new_gvar(globals, ident, ident_len, node->type.type, false);
             }
+            if(attribute_no_instrument) {
+                gvar->no_instrument = true;
+            }
+            if(attribute_noreturn) {
+                gvar->is_noreturn = true;
+            }
 
             var_node = new_node(ND_FUNC_DECL, node, NULL);
         } else {
-            var_node = variable_definition(is_global, node, type_storage);
+            var_node = variable_definition(is_global, node, type_storage, tk_count[TK_CONST] > 0);
         }
         vector_push(list_node->decl_list.decls, var_node);
 
@@ -1731,15 +1838,19 @@ Node *type_(bool need_ident, bool is_global, bool parse_one_type) {
 
 Node *type_pointer(bool need_ident) {
     if(consume("*")) {
+        bool is_volatile = false;
         while(1) {
             if(consume_kind(TK_CONST)) {
             } else if(consume_kind(TK_RESTRICT)) {
             } else if(consume_kind(TK_VOLATILE)) {
+                is_volatile = true;
             } else {
                 break;
             }
         }
-        return new_node(ND_TYPE_POINTER, type_pointer(need_ident), NULL);
+        Node *node = new_node(ND_TYPE_POINTER, type_pointer(need_ident), NULL);
+        node->type.is_volatile = is_volatile;
+        return node;
     }
     return type_array(need_ident);
 }
@@ -1874,6 +1985,10 @@ Vector *function_arguments(bool *is_vararg) {
 Node *struct_declaration(bool is_struct) {
     char *ident;
     int ident_len;
+    int attr_align = 0;
+    if(consume_kind(TK_ATTRIBUTE)) {
+        attr_align = alignment_specifier(TK_ATTRIBUTE);
+    }
     // ident is optional
     if(!consume_ident(&ident, &ident_len)) {
         char buf[100];
@@ -1907,17 +2022,32 @@ Node *struct_declaration(bool is_struct) {
         } else {
             node->type.type = type_new_struct(ident, ident_len);
         }
-        node->type.type->members = struct_members(&node->type.type->struct_size, is_struct);
+        Type *type = node->type.type;
+        int align = 1;
+        type->members = struct_members(&type->struct_size, &align, is_struct);
         if(!found) {
             entry = calloc(1, sizeof(StructRegistryEntry));
             entry->ident = ident;
             entry->ident_len = ident_len;
+            entry->is_struct = is_struct;
             entry->type = node->type.type;
             entry->type->struct_complete = true;
             vector_push(reg, entry);
         }
 
         expect("}");
+        if(consume_kind(TK_ATTRIBUTE)) {
+            int value = alignment_specifier(TK_ATTRIBUTE);
+            if(attr_align < value) {
+                attr_align = value;
+            }
+        }
+        // Tail padding makes the size a multiple of the alignment, so elements of an array stay aligned.
+        if(align < attr_align) {
+            align = attr_align;
+        }
+        type->struct_align = align;
+        type->struct_size = (type->struct_size + align - 1) / align * align;
     } else {
         bool found = false;
         StructRegistryEntry *entry;
@@ -1932,6 +2062,7 @@ Node *struct_declaration(bool is_struct) {
             entry = calloc(1, sizeof(StructRegistryEntry));
             entry->ident = ident;
             entry->ident_len = ident_len;
+            entry->is_struct = is_struct;
             node->type.type = type_new_struct(ident, ident_len);
             entry->type = node->type.type;
             entry->type->struct_complete = false;
@@ -1945,8 +2076,29 @@ Node *struct_declaration(bool is_struct) {
     return node;
 }
 
+// Places member at the end of the members laid out so far, following the SysV x86-64 ABI.
+void layout_struct_member(StructMember *member, int member_align, size_t *size, int *align, bool is_struct) {
+    int member_size = type_sizeof(member->type);
+    if(member_align < type_alignof(member->type)) {
+        member_align = type_alignof(member->type);
+    }
+    member->align = member_align;
+    if(*align < member_align) {
+        *align = member_align;
+    }
+    if(is_struct) {
+        member->offset = (*size + member_align - 1) / member_align * member_align;
+        *size = member->offset + member_size;
+    }else{
+        member->offset = 0;
+        if(*size < member_size) {
+            *size = member_size;
+        }
+    }
+}
+
 // struct_members = ( type_ ";" )*
-Vector *struct_members(size_t *size, bool is_struct) {
+Vector *struct_members(size_t *size, int *align, bool is_struct) {
     Vector *vec = new_vector();
     while(peek_type_prefix()) {
         Node *decl_list = type_(true, false, false);
@@ -1958,15 +2110,7 @@ Vector *struct_members(size_t *size, bool is_struct) {
             StructMember *member = calloc(1, sizeof(StructMember));
             member->type = decl_list->decl_list.base_type;
             member->unnamed = true;
-            if(is_struct) {
-                member->offset = *size;
-                *size += type_sizeof(member->type);
-            }else{
-                member->offset = 0;
-                if(*size < type_sizeof(member->type)) {
-                    *size = type_sizeof(member->type);
-                }
-            }
+            layout_struct_member(member, 1, size, align, is_struct);
             vector_push(vec, member);
         }else{
             for(int i = 0; i < vector_size(decl_list->decl_list.decls); i++){
@@ -1981,15 +2125,7 @@ Vector *struct_members(size_t *size, bool is_struct) {
                     }
                 }
                 member->type = type_node->type.type;
-                if(is_struct) {
-                    member->offset = *size;
-                    *size += type_sizeof(type_node->type.type);
-                }else{
-                    member->offset = 0;
-                    if(*size < type_sizeof(type_node->type.type)) {
-                        *size = type_sizeof(type_node->type.type);
-                    }
-                }
+                layout_struct_member(member, type_node->type.align, size, align, is_struct);
                 vector_push(vec, member);
             }
         }
@@ -1997,6 +2133,79 @@ Vector *struct_members(size_t *size, bool is_struct) {
     return vec;
 }
 
+// Set when alignment_specifier() sees no_instrument_function and noreturn.
+bool attribute_no_instrument = false;
+bool attribute_noreturn = false;
+
+// alignment_specifier = "_Alignas" "(" ( type | constant_expression ) ")"
+//                     | "__attribute__" "(" "(" ( attribute ( "," attribute )* )? ")" ")"
+// The keyword is already consumed. Returns the requested alignment, or 0 if there is none.
+// Attributes other than aligned, no_instrument_function and noreturn are ignored.
+int alignment_specifier(TokenKind kind) {
+    int align = 0;
+    expect("(");
+    if(kind == TK_ALIGNAS) {
+        TokenKind type_kind;
+        if(consume_type_prefix(&type_kind)) {
+            unget_token();
+            Node *type_node = type_(false, false, true);
+            Node *var_node = vector_get(type_node->decl_list.decls, 0);
+            align = type_alignof(var_node->lhs->type.type);
+        }else {
+            align = alignment_value();
+        }
+        expect(")");
+        return align;
+    }
+    expect("(");
+    while(!consume(")")) {
+        bool is_aligned = token->len == 7 && memcmp(token->str, "aligned", 7) == 0
+            || token->len == 11 && memcmp(token->str, "__aligned__", 11) == 0;
+        if(token->len == 22 && memcmp(token->str, "no_instrument_function", 22) == 0
+                || token->len == 26 && memcmp(token->str, "__no_instrument_function__", 26) == 0) {
+            attribute_no_instrument = true;
+        }
+        if(token->len == 8 && memcmp(token->str, "noreturn", 8) == 0
+                || token->len == 12 && memcmp(token->str, "__noreturn__", 12) == 0) {
+            attribute_noreturn = true;
+        }
+        next_token();
+        if(is_aligned) {
+            // Without an argument, the largest alignment of any type is used.
+            int value = 16;
+            if(consume("(")) {
+                value = alignment_value();
+                expect(")");
+            }
+            if(align < value) {
+                align = value;
+            }
+        }else if(consume("(")) {
+            int depth = 1;
+            while(depth) {
+                if(consume("(")) {
+                    depth++;
+                }else if(consume(")")) {
+                    depth--;
+                }else {
+                    next_token();
+                }
+            }
+        }
+        consume(",");
+    }
+    expect(")");
+    return align;
+}
+
+int alignment_value() {
+    Node *node = constant_fold(constant_expression());
+    if(node->kind != ND_NUM || node->val == 0 || (node->val & (node->val - 1))) {
+        error_at(token->str, "Alignment must be a constant power of two");
+    }
+    return node->val;
+}
+
 // enum_declaration = "enum" ident ( "{" enum_members "}" )?
 Node *enum_declaration() {
     char *ident;
@@ -2145,6 +2354,9 @@ bool peek_type_prefix() {
     case TK_RESTRICT:
     case TK_VOLATILE:
     case TK_INLINE:
+    case TK_ALIGNAS:
+    case TK_ATTRIBUTE:
+    case TK_NORETURN:
         return true;
     }
     char *ident;
@@ -2160,6 +2372,19 @@ bool peek_type_prefix() {
     return false;
 }
 
+// Returns the registered literal with the same text as literal, registering literal if there is none.
+StringLiteral *intern_string_literal(StringLiteral *literal) {
+    for(int i = 0; i < vector_size(global_string_literals); i++) {
+        StringLiteral *cur = vector_get(global_string_literals, i);
+        if(cur->len == literal->len && memcmp(cur->str, literal->str, literal->len) == 0) {
+            return cur;
+        }
+    }
+    literal->index = vector_size(global_string_literals);
+    vector_push(global_string_literals, literal);
+    return literal;
+}
+
 Node *create_func_name_literal() {
     Node *node = new_node(ND_STRING_LITERAL, NULL, NULL);
     node->string_literal.literal = calloc(1, sizeof(StringLiteral));
@@ -2180,8 +2405,8 @@ Node *create_func_name_literal() {
         vector_push(node->string_literal.literal->char_vec, (void *)(long)p[i + 1]);
     }
     node->string_literal.literal->vec_len = vector_size(node->string_literal.literal->char_vec);
-    node->string_literal.literal->index = vector_size(global_string_literals);
-    vector_push(global_string_literals, node->string_literal.literal);
+    node->string_literal.literal = intern_string_literal(node->string_literal.literal);
+    node->expr_type = type_new_ptr(&char_type);
 
     return node;
 }
@@ -2209,6 +2434,20 @@ LVar *find_lvar_one(Vector *locals, char *ident, int ident_len) {
     return NULL;
 }
 
+// Pads the locals so that the next variable of type is aligned, assuming its size is added next.
+// rbp is only guaranteed to be 8-byte aligned, so larger alignments are capped to 8.
+void align_locals(Node *scope, Type *type, int align) {
+    if(align < type_alignof(type)) {
+        align = type_alignof(type);
+    }
+    if(align > 8) {
+        align = 8;
+    }
+    int pad = (align - (locals_stack_size + type_sizeof(type)) % align) % align;
+    scope->scope.current += pad;
+    locals_stack_size += pad;
+}
+
 LVar *new_lvar(Vector *locals, char *ident, int ident_len) {
     LVar *lvar = calloc(1, sizeof(LVar));
     lvar->name = ident;
@@ -2229,7 +2468,160 @@ int lvar_stack_size(Vector *locals) {
     return ret;
 }
 
-Node *lvar_initializer_node(LVar *base_var, size_t offset, Node *init_expr, Type *type) {
+// Whether init_expr has an element for every scalar in type.
+bool initializer_is_complete(Node *init_expr, Type *type) {
+    if(type_is_scalar(type) || init_expr->kind != ND_INIT) {
+        return true;
+    }
+    int n = 0;
+    if(type->ty == ARRAY) {
+        n = type->array_size;
+    }else if(type->ty == STRUCT) {
+        n = vector_size(type->members);
+    }
+    if(vector_size(init_expr->init.init_expr) < n) {
+        return false;
+    }
+    for(int i = 0; i < n; i++) {
+        Node *expr = vector_get(init_expr->init.init_expr, i);
+        Type *elem_type;
+        if(type->ty == ARRAY) {
+            elem_type = type->ptr_to;
+        }else {
+            StructMember *member = vector_get(type->members, i);
+            elem_type = member->type;
+        }
+        if(!initializer_is_complete(expr, elem_type)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Returns a copy of init_expr whose scalars are all integer constants, or NULL if some are not.
+Node *constant_initializer(Node *init_expr, Type *type) {
+    if(type_is_scalar(type)) {
+        Node *expr = init_expr;
+        if(expr->kind == ND_INIT) {
+            if(vector_size(expr->init.init_expr) == 0) {
+                return new_node_num(0);
+            }
+            expr = vector_get(expr->init.init_expr, 0);
+        }
+        expr = constant_fold(expr);
+        if(expr->kind != ND_NUM || !type_is_int(expr->expr_type)) {
+            return NULL;
+        }
+        if(type->ty == BOOL && expr->val > 1) {
+            return NULL;
+        }
+        if(!type_is_int(type) && !(type->ty == PTR && expr->val == 0)) {
+            return NULL;
+        }
+        return expr;
+    }
+    if(init_expr->kind != ND_INIT || (type->ty != ARRAY && type->ty != STRUCT)) {
+        return NULL;
+    }
+    Node *node = new_node(ND_INIT, NULL, NULL);
+    node->init.init_expr = new_vector();
+    for(int i = 0; i < vector_size(init_expr->init.init_expr); i++) {
+        Type *elem_type;
+        if(type->ty == ARRAY) {
+            elem_type = type->ptr_to;
+        }else {
+            StructMember *member = vector_get(type->members, i);
+            elem_type = member->type;
+        }
+        Node *expr = constant_initializer(vector_get(init_expr->init.init_expr, i), elem_type);
+        if(expr == NULL) {
+            return NULL;
+        }
+        vector_push(node->init.init_expr, expr);
+    }
+    return node;
+}
+
+bool is_zero_initializer(Node *init_expr) {
+    if(init_expr->kind == ND_NUM) {
+        return init_expr->val == 0;
+    }
+    if(init_expr->kind != ND_INIT) {
+        return false;
+    }
+    for(int i = 0; i < vector_size(init_expr->init.init_expr); i++) {
+        if(!is_zero_initializer(vector_get(init_expr->init.init_expr, i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// *(base_var + offset) as type
+Node *lvar_offset_node(LVar *base_var, size_t offset, Type *type) {
+    Node *addressof = new_node(ND_ADDRESS_OF, new_node_lvar(base_var), NULL);
+    addressof->expr_type = type_new_ptr(&char_type);
+    Node *deref_node = new_node(ND_DEREF, new_node_binop(ND_ADD, addressof, new_node_num(offset)), NULL);
+    deref_node->expr_type = type;
+    return deref_node;
+}
+
+// Initializes an aggregate by copying the non-zero prefix from a template in .rodata and
+// filling the remainder with zero. init_expr must be built by constant_initializer().
+// Returns NULL if the prefix is too small to be worth a template.
+Node *lvar_template_initializer_node(LVar *base_var, Node *init_expr, Type *type) {
+    Type *template_type = type;
+    Node *template_init = init_expr;
+    if(type->ty == ARRAY) {
+        int n = vector_size(init_expr->init.init_expr);
+        while(n > 0 && is_zero_initializer(vector_get(init_expr->init.init_expr, n - 1))) {
+            n--;
+        }
+        template_type = type_new_array(type->ptr_to, true, n);
+        template_init = new_node(ND_INIT, NULL, NULL);
+        template_init->init.init_expr = new_vector();
+        for(int i = 0; i < n; i++) {
+            vector_push(template_init->init.init_expr, vector_get(init_expr->init.init_expr, i));
+        }
+    }
+    int prefix_size = type_sizeof(template_type);
+    if(prefix_size <= 8) {
+        return NULL;
+    }
+
+    char buf[32];
+    sprintf(buf, ".L_I_%d", vector_size(init_templates));
+    GVar *gvar = calloc(1, sizeof(GVar));
+    gvar->name = malloc(strlen(buf) + 1);
+    memcpy(gvar->name, buf, strlen(buf) + 1);
+    gvar->len = strlen(buf);
+    gvar->type = template_type;
+    gvar->has_definition = true;
+    Node *def_node = new_node(ND_GVAR_DEF, NULL, NULL);
+    def_node->gvar_def.gvar = gvar;
+    def_node->gvar_def.init_expr = template_init;
+    vector_push(init_templates, def_node);
+
+    Node *init_code_node = new_node(ND_COMPOUND, NULL, NULL);
+    init_code_node->compound_stmt_list = new_vector();
+    int rest_size = type_sizeof(type) - prefix_size;
+    if(rest_size > 0) {
+        Node *zero_node = new_node(ND_MEMZERO, lvar_offset_node(base_var, prefix_size, NULL), NULL);
+        zero_node->expr_type = type_new_array(&char_type, true, rest_size);
+        zero_node->lhs->expr_type = zero_node->expr_type;
+        vector_push(init_code_node->compound_stmt_list, zero_node);
+    }
+    Node *template_node = new_node(ND_GVAR, NULL, NULL);
+    template_node->gvar.gvar = gvar;
+    template_node->expr_type = template_type;
+    Node *copy_node = new_node(ND_ASSIGN, lvar_offset_node(base_var, 0, template_type), template_node);
+    copy_node->expr_type = template_type;
+    vector_push(init_code_node->compound_stmt_list, copy_node);
+    return init_code_node;
+}
+
+// If zero_filled, the object is already filled with zero and elements initialized with zero are skipped.
+Node *lvar_initializer_node(LVar *base_var, size_t offset, Node *init_expr, Type *type, bool zero_filled) {
     if(init_expr->kind == ND_INIT && !type_is_scalar(type)) {
         Node *init_code_node = new_node(ND_COMPOUND, NULL, NULL);
         init_code_node->compound_stmt_list = new_vector();
@@ -2257,11 +2649,11 @@ Node *lvar_initializer_node(LVar *base_var, size_t offset, Node *init_expr, Type
             Node *lvar_node = new_node_lvar(base_var);
             Node *node;
             if(type->ty == ARRAY) {
-                node = lvar_initializer_node(base_var, offset, expr, type->ptr_to);
+                node = lvar_initializer_node(base_var, offset, expr, type->ptr_to, zero_filled);
                 offset += type_sizeof(type->ptr_to);
             }else{
                 StructMember *member = vector_get(type->members, i);
-                node = lvar_initializer_node(base_var, offset + member->offset, expr, member->type);
+                node = lvar_initializer_node(base_var, offset + member->offset, expr, member->type, zero_filled);
             }
 
             vector_push(init_code_node->compound_stmt_list, node);
@@ -2276,14 +2668,10 @@ Node *lvar_initializer_node(LVar *base_var, size_t offset, Node *init_expr, Type
                 expr = new_node_num(0);
             }
         }
-        Node *lvar_node = new_node_lvar(base_var);
-
-        Node *addressof = new_node(ND_ADDRESS_OF, lvar_node, NULL);
-        addressof->expr_type = type_new_ptr(&char_type);
-        Node *deref_node = new_node(ND_DEREF, new_node_binop(ND_ADD, addressof, new_node_num(offset)), NULL);
-        deref_node->expr_type = type;
-
-        return new_node_assignment(deref_node, expr);
+        if(zero_filled && expr->kind == ND_NUM && expr->val == 0) {
+            return new_node_num(0);
+        }
+        return new_node_assignment(lvar_offset_node(base_var, offset, type), expr);
     }
 }
 
@@ -2374,6 +2762,16 @@ int type_sizeof(Type *type) {
     return 8;
 }
 
+int type_alignof(Type *type) {
+    if(type->ty == ARRAY) {
+        return type_alignof(type->ptr_to);
+    }
+    if(type->ty == STRUCT || type->ty == UNION) {
+        return type->struct_align ? type->struct_align : 1;
+    }
+    return type_sizeof(type);
+}
+
 Type *type_arithmetic(Type *type_r, Type *type_l) {
     if(type_r->ty == PTR || type_r->ty == PTR){
         error_at(token->str, "Invalid arithmetic operand with ptr type");
@@ -2795,6 +3193,96 @@ void dumpnodes(Node *node) {
     dumpnodes_inner(node, 0);
 }
 
+// Prints a padding hole of size bytes at offset, if any.
+static void dump_struct_hole(int offset, int size, bool json, bool *first) {
+    if(size <= 0) {
+        return;
+    }
+    if(json) {
+        fprintf(stderr, "%s{\"offset\": %d, \"size\": %d}", *first ? "" : ", ", offset, size);
+        *first = false;
+    }else {
+        fprintf(stderr, "  %6d %6d %6s %6s  (padding)\n", offset, size, "", "");
+    }
+}
+
+// Prints offset, size, alignment, padding holes and 64-byte cache lines of members of
+// every complete struct and union to stderr.
+void dump_struct_layout(bool json) {
+    if(json) {
+        fprintf(stderr, "[");
+    }
+    bool first_type = true;
+    for(int r = 0; r < 2; r++) {
+        Vector *reg = r == 0 ? struct_registry : union_registry;
+        for(int i = 0; i < vector_size(reg); i++) {
+            StructRegistryEntry *entry = vector_get(reg, i);
+            Type *type = entry->type;
+            if(!type->struct_complete) {
+                continue;
+            }
+            char *kind = entry->is_struct ? "struct" : "union";
+            int size = type_sizeof(type);
+            if(json) {
+                fprintf(stderr, "%s\n  {\"kind\": \"%s\", \"name\": \"%.*s\", \"size\": %d, \"align\": %d, \"members\": [",
+                        first_type ? "" : ",", kind, entry->ident_len, entry->ident, size, type_alignof(type));
+            }else {
+                fprintf(stderr, "%s %.*s: size %d, align %d\n", kind, entry->ident_len, entry->ident, size, type_alignof(type));
+                fprintf(stderr, "  %6s %6s %6s %6s  %s\n", "offset", "size", "align", "line", "member");
+            }
+            first_type = false;
+
+            // Holes are printed in place in text, and collected in a separate list in JSON.
+            int end = 0;
+            for(int j = 0; j < vector_size(type->members); j++) {
+                StructMember *member = vector_get(type->members, j);
+                int member_size = type_sizeof(member->type);
+                int first_line = member->offset / 64;
+                int last_line = member_size ? (member->offset + member_size - 1) / 64 : first_line;
+                char *name = member->unnamed ? "(unnamed)" : member->ident;
+                int name_len = member->unnamed ? strlen(name) : member->ident_len;
+                if(json) {
+                    fprintf(stderr, "%s\n    {\"name\": \"%.*s\", \"offset\": %d, \"size\": %d, \"align\": %d, \"cache_line\": %d, \"cache_line_end\": %d}",
+                            j ? "," : "", name_len, name, member->offset, member_size, member->align, first_line, last_line);
+                }else {
+                    bool first = true;
+                    dump_struct_hole(end, member->offset - end, false, &first);
+                    char line[32];
+                    if(first_line == last_line) {
+                        sprintf(line, "%d", first_line);
+                    }else {
+                        sprintf(line, "%d-%d", first_line, last_line);
+                    }
+                    fprintf(stderr, "  %6d %6d %6d %6s  %.*s\n", member->offset, member_size, member->align, line, name_len, name);
+                }
+                if(end < member->offset + member_size) {
+                    end = member->offset + member_size;
+                }
+            }
+            if(!json) {
+                bool first = true;
+                dump_struct_hole(end, size - end, false, &first);
+                continue;
+            }
+            fprintf(stderr, "], \"holes\": [");
+            bool first = true;
+            end = 0;
+            for(int j = 0; j < vector_size(type->members); j++) {
+                StructMember *member = vector_get(type->members, j);
+                dump_struct_hole(end, member->offset - end, true, &first);
+                if(end < member->offset + type_sizeof(member->type)) {
+                    end = member->offset + type_sizeof(member->type);
+                }
+            }
+            dump_struct_hole(end, size - end, true, &first);
+            fprintf(stderr, "]}");
+        }
+    }
+    if(json) {
+        fprintf(stderr, "\n]\n");
+    }
+}
+
 char *mystrdup(char *p) {
     int len = strlen(p);
     char *q = malloc(len + 1);
@@ -28,6 +28,7 @@ typedef struct FuncDefArg FuncDefArg;
 typedef struct LVar LVar;
 typedef struct Type Type;
 typedef struct GVar GVar;
+typedef struct VectorLoop VectorLoop;
 typedef struct StringLiteral StringLiteral;
 typedef struct StructMember StructMember;
 typedef struct StructRegistryEntry StructRegistryEntry;
@@ -63,6 +64,9 @@ typedef enum {
     TK_RESTRICT,
     TK_VOLATILE,
     TK_INLINE,
+    TK_ALIGNAS,
+    TK_ATTRIBUTE,
+    TK_NORETURN,
     TK_RETURN,
     TK_IF,
     TK_ELSE,
@@ -205,6 +209,10 @@ typedef enum {
     ND_DO,
     ND_COMPOUND,
     ND_CALL,
+    ND_INLINE,
+    ND_VECTOR_LOOP,
+    ND_VECTOR_OPERAND,
+    ND_MEMZERO,
     ND_POSTFIX_INC,
     ND_POSTFIX_DEC,
     ND_PREFIX_INC,
@@ -251,6 +259,10 @@ struct Node {
     Node *rhs;
     Type *expr_type;
     LineInfo *line_info;
+    // Index of the first profile counter plus one, 0 if the node is not counted. See assign_profile_counters.
+    int prof_counter;
+    // Counts read by -fprofile-use, in the order of the node's counters.
+    unsigned long prof_count[2];
     union {
         unsigned long val;
         LVar *lvar;
@@ -263,6 +275,8 @@ struct Node {
         } decl_var;
         struct {
             Type *type;
+            int align; // requested by _Alignas or __attribute__((aligned)), 0 if none
+            bool is_volatile; // the declared object is volatile
             union {
                 struct {
                     Vector *args;
@@ -286,6 +300,7 @@ struct Node {
             char *call_ident;
             int call_ident_len;
             NodeList call_arg_list;
+            bool is_tail_call;
         };
         struct {
             char *ident;
@@ -295,6 +310,9 @@ struct Node {
             int max_stack_size;
             bool is_inline;
             TypeStorage type_storage;
+            bool uses_frame; // accesses locals on the stack
+            bool no_instrument; // __attribute__((no_instrument_function))
+            int saved_regs; // callee saved registers holding variables, the first ones of reg_vars
         } func_def;
         struct {
             char *ident;
@@ -334,6 +352,14 @@ struct Node {
             Vector *cases;
             Node *default_stmt;
         } switch_;
+        struct {
+            Node *func;
+        } inline_;
+        VectorLoop *vector_loop;
+        struct {
+            bool is_load; // lhs is the base address of an array indexed by the loop counter, otherwise a broadcast scalar.
+            int reg;
+        } vector_operand;
     };
 };
 
@@ -343,7 +369,7 @@ Node *translation_unit();
 Node *external_declaration();
 Node *function_definition(TypeStorage type_storage, Node *type_node, bool is_inline);
 Node *global_variable_definition(Node *type_prefix, char *ident, int ident_len, bool has_definition);
-Node *variable_definition(bool is_global, Node *type_node, TypeStorage type_storage);
+Node *variable_definition(bool is_global, Node *type_node, TypeStorage type_storage, bool is_const);
 Node *initializer(Type *type);
 Node *stmt();
 Node *expression();
@@ -372,7 +398,12 @@ Node *type_ident(bool need_ident);
 Node *ident_();
 Vector *function_arguments(bool *is_vararg);
 Node *struct_declaration(bool is_struct);
-Vector *struct_members(size_t *size, bool is_struct);
+Vector *struct_members(size_t *size, int *align, bool is_struct);
+extern bool attribute_no_instrument;
+extern bool attribute_noreturn;
+int alignment_specifier(TokenKind kind);
+int alignment_value();
+void layout_struct_member(StructMember *member, int member_align, size_t *size, int *align, bool is_struct);
 Node *enum_declaration();
 Vector *enum_members();
 Node *typedef_declaration(bool is_global, Node *type_node);
@@ -380,10 +411,15 @@ bool consume_type_prefix(TokenKind *kind);
 TokenKind expect_type_prefix();
 bool peek_type_prefix();
 Node *constant_fold(Node *node);
+StringLiteral *intern_string_literal(StringLiteral *literal);
 Node *create_func_name_literal();
 Node *apply_int_promotion(Node *node);
+Node *new_node(NodeKind kind, Node *lhs, Node *rhs);
 Node *new_node_num(unsigned long val);
 Node *new_node_conv(Node *node, Type *new_type);
+Node *new_node_lvar(LVar *lvar);
+Node *new_node_assignment(Node *lhs, Node *rhs);
+char *node_kind(NodeKind kind);
 
 /// LVar ///
 
@@ -393,16 +429,23 @@ struct LVar {
     int offset;
     Type *type;
     int func_arg_index; // 0 means it is not func arg. For a function argument, it indicates argument index + 1.
+    int reg; // 0 means it is on the stack. Otherwise it is held in register (reg - 1), see reg_vars in codegen.c.
+    bool is_volatile; // every access goes to memory
 };
 
 extern int locals_stack_size;
 
 LVar *find_lvar_scope(char *ident, int ident_len);
 LVar *find_lvar_one(Vector *locals, char *ident, int ident_len);
+void align_locals(Node *scope, Type *type, int align);
 LVar *new_lvar(Vector *locals, char *ident, int ident_len);
 int lvar_count(Vector *locals);
 int lvar_stack_size(Vector *locals);
-Node *lvar_initializer_node(LVar *base_var, size_t offset, Node *init_expr, Type *type);
+bool initializer_is_complete(Node *init_expr, Type *type);
+Node *constant_initializer(Node *init_expr, Type *type);
+bool is_zero_initializer(Node *init_expr);
+Node *lvar_initializer_node(LVar *base_var, size_t offset, Node *init_expr, Type *type, bool zero_filled);
+Node *lvar_template_initializer_node(LVar *base_var, Node *init_expr, Type *type);
 
 /// GVar ///
 
@@ -414,6 +457,12 @@ struct GVar {
     int enum_num;
     bool has_definition;
     bool is_builtin;
+    bool is_const;
+    bool is_static;
+    int align; // requested alignment, 0 if none
+    bool no_instrument; // function declared with __attribute__((no_instrument_function))
+    bool is_noreturn; // function declared with _Noreturn or __attribute__((noreturn))
+    bool is_volatile; // every access goes to memory
 };
 
 extern Vector *globals;
@@ -430,9 +479,11 @@ struct StringLiteral {
     Vector *char_vec;
     int vec_len;
     int index;
+    bool used;
 };
 
 extern Vector *global_string_literals;
+extern Vector *init_templates;
 
 /// Type ///
 
@@ -448,10 +499,16 @@ struct Type {
     int ident_len; // enum or struct or union
     Vector *members; // enum or struct or union
     size_t struct_size; // struct or union
+    int struct_align; // struct or union
     bool struct_complete; // struct or union
+    bool is_volatile; // qualified by volatile. Set on scalar types only.
 };
 
+extern Type signed_int_type;
+extern Type signed_long_type;
+
 int type_sizeof(Type *type);
+int type_alignof(Type *type);
 Type *type_arithmetic(Type *type_r, Type *type_l);
 Node *type_comparator(Node *node, Type *type_r, Type *type_l);
 Type *type_logical(Type *type_r, Type *type_l);
@@ -481,6 +538,7 @@ StructMember *find_struct_member(Vector *member_list, char *ident, int ident_len
 struct StructMember {
     Type *type;
     int offset;
+    int align;
     char *ident;
     int ident_len;
     bool unnamed;
@@ -534,9 +592,56 @@ bool compare_ident(char *ident_a, int ident_a_len, char *ident_b, int ident_b_le
 bool compare_slice(char *slice, int slice_len, char *null_term_str);
 
 Token *tokenize(char *);
+extern char *stack_usage_path;
+extern int frame_larger_than;
 void init_codegen();
+void finish_codegen();
 void gen(Node *);
 
 void dumpnodes(Node *node);
+void dump_struct_layout(bool json);
+
+/// Optimize ///
+
+extern bool opt_no_inline;
+extern bool opt_avx2;
+extern bool opt_no_sibling_calls;
+extern bool opt_instrument_functions;
+bool is_instrumented(Node *func);
+
+extern bool profile_generate;
+extern bool profile_use;
+extern char *profile_path;
+extern int profile_counters;
+extern unsigned long profile_checksum;
+void assign_profile_counters(Node *trans_unit, Token *tokens);
+unsigned long profile_count(Node *node);
+bool profile_is_cold(Node *node);
+bool profile_is_hot(Node *node);
+bool profile_else_is_likely(Node *node);
+bool builtin_expect_operand(Node *node, Node **exp, unsigned long *expected);
+bool branch_is_cold(Node *node, bool then_branch);
+bool loop_is_hot(Node *node);
+
+typedef enum {
+    VL_MAP,       // dest[i] = expr
+    VL_SUM,       // acc += expr
+    VL_SUM_BYTES, // acc += (unsigned char)expr
+    VL_MIN,       // acc = min(acc, expr)
+    VL_MAX,       // acc = max(acc, expr)
+} VectorLoopKind;
+
+// Vectorized form of `for(; iv < bound; iv++)`. The original loop runs the remaining iterations.
+struct VectorLoop {
+    VectorLoopKind kind;
+    int elem_size;
+    Node *iv;
+    Node *bound;
+    Node *dest; // base address of the stored array
+    Node *acc;  // reduction variable
+    Node *expr; // element-wise expression. Leaves are ND_VECTOR_OPERAND.
+};
+
+void optimize(Node *trans_unit);
 
 char *mystrdup(char *p);
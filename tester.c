@@ -219,7 +219,7 @@ int main() {
     assert_file(1, "int func(int a);int main(){return 1;}");
     assert_file(1, "struct a{};int main(){return 1;}");
     assert_file(1, "struct a{}b;int main(){return 1;}");
-    assert_file(21, "struct aa{int f;int q;int m;int *g;char p;}p;int main(){return sizeof(p);}");
+    assert_file(32, "struct aa{int f;int q;int m;int *g;char p;}p;int main(){return sizeof(p);}");
     assert_file(8, "int printf(char *s);struct st{int a;int b;}c;int main(){char *p=&c;c.a=1;c.b=7;return p[0]+p[4];}");
     assert_file(11, "int printf(char *s);struct st{int a;int b;}c;int main(){struct st *q;q=&c;char *p=&c;q->a=2;q->b=9;return p[0]+c.b;}");
     assert_file(3, "enum a{f,g,h};int main(){return g+h;}");
@@ -372,8 +372,8 @@ int main() {
     assert_file(107, "struct A {int a; char *b;};struct A a={10, \"abc\"};int main(){return a.a + a.b[0];}");
     assert_file(110, "struct A {int a; char b[10];};struct A a[]={{10, \"abc\"}, {3, \"def\"}};int main(){return a[0].a + a[1].b[0];}");
     assert_file(110, "struct A {int a; char *b;};struct A a[]={{10, \"abc\"}, {3, \"def\"}};int main(){return a[0].a + a[1].b[0];}");
-    assert_file(134, "struct A {int a; char *b;};struct A a[]={{10, \"abc\"}, {3, \"def\"},};int main(){return a[0].a + a[1].b[0] + sizeof(a);}");
-    assert_file(134, "struct A {int a; char *b;};int main(){struct A a[]={{10, \"abc\"}, {3, \"def\"},};return a[0].a + a[1].b[0] + sizeof(a);}");
+    assert_file(142, "struct A {int a; char *b;};struct A a[]={{10, \"abc\"}, {3, \"def\"},};int main(){return a[0].a + a[1].b[0] + sizeof(a);}");
+    assert_file(142, "struct A {int a; char *b;};int main(){struct A a[]={{10, \"abc\"}, {3, \"def\"},};return a[0].a + a[1].b[0] + sizeof(a);}");
     assert_file(11, "int strlen();int func(int a, char *p, char c, ...) {return a+strlen(p)+c;}int main(){return func(3,\"aaaa\",4);}");
     assert_stdout(24, "aaaa:99 Hello va_list", "#define va_list __builtin_va_list\n#define va_start __builtin_va_start\n#define va_end __builtin_va_end\nint vprintf();int func(int a, char *p, char c, ...) {va_list ap;va_start(ap, c);vprintf(p, ap);va_end(ap);return sizeof(ap);}int main(){return func(3,\"aaaa:%d %s\",4,99,\"Hello va_list\");}");
     assert_file(45, "int main(){int i = 0;int a=0; while(1){i++;int j = 0; while(1){j++;a+=j;if(j>=5)break;} if(i<3){continue;}break;}return a;}");
@@ -411,6 +411,90 @@ int main() {
     assert_file(0, "int main(){long k=100000000000;return (long)(int)k == 100000000000;}");
     assert_file(1, "int main(){int a[1+(int)sizeof(long)];return sizeof(a)==4*9;}");
     assert_file(1, "int main(){int a[1+(char)(250+sizeof(long))];return sizeof(a)==4*3;}");
+    assert_file(7, "static int add(int a,int b){return a+b;}int main(){return add(3,4);}");
+    assert_file(70, "inline int f(int x){int y=x*2;if(y>10){return 10;}return y;}int main(){int s=0;for(int i=0;i<10;i=i+1){s=s+f(i);}return s;}");
+    assert_file(120, "int fact(int n){if(n<=1){return 1;}return n*fact(n-1);}int main(){return fact(5);}");
+    assert_file(12, "static int g(int a){a=a+1;return a;}int main(){int a=5;int b=g(a);return a+b+g(0)-g(-1)+0*b;}");
+    assert_file(3, "static int sw(int a){switch(a){case 1:switch(a+1){case 2:return 3;}return 4;default:return 5;}}int main(){return sw(1);}");
+    assert_file(1, "int main(){int n=-100;return n/7==-14 && n%7==-2 && n/8==-12 && n%8==-4 && n/-3==33 && n%-3==-1;}");
+    assert_file(1, "int main(){unsigned u=4000000000U;return u/7==571428571 && u%7==3 && u/16==250000000 && u%16==0;}");
+    assert_file(1, "int main(){long l=-1234567891011;int d=-7;return l/1000==-1234567891 && l%1000==-11 && l/-1024==1205632706 && 100/d==-14;}");
+    assert_file(1, "int main(){int a[10];long b[4];for(int i=0;i<10;i=i+1){a[i]=i*7;}b[3]=a[9]*3;return b[3]==189 && a[5]*10==350 && a[3]*-5==-105 && *(a+9-1)==56;}");
+    assert_file(56, "int f(int x){switch(x){case 1:return 10;case 2:return 20;case 3:return 30;case 5:return 50;case 6:return 60;default:return 1;}}int main(){int s=0;for(int i=-2;i<9;i=i+1){s=s+f(i);}return s-120;}");
+    assert_file(28, "int f(long x){switch(x){case -1000:return 1;case 7:return 2;case 100:return 3;case 5000:return 4;case 100000:return 5;case 3000000000:return 6;case -5:return 7;}return 0;}int main(){return f(-1000)+f(7)+f(100)+f(5000)+f(100000)+f(3000000000)+f(-5)+f(8);}");
+    assert_file(7, "int f(unsigned char c){switch(c){case 200:return 1;case 201:return 2;case 202:return 3;case 203:return 4;}return 0;}int main(){return f(200)+f(201)+f(203)+f(204);}");
+    assert_file(1, "int main(){return (2 && 3) + (0 || 5) - 1;}");
+    assert_file(1, "int main(){unsigned a=1;int b=-1;long c=-1;unsigned long d=1;return (a < 4000000000U) + (b < 0) + (-1 < c) + (d > c) == 2;}");
+    assert_file(1, "int main(){int x=2147483647;x=x+1;return x < 0;}");
+    assert_file(55, "int main(){int s=0;int i=0;while(!(i>10)){if(i>3 && i<7 || i==10){s=s+i;}i=i+1;}do{s=s+1;}while(s<40 ? 1 : s<55);return s;}");
+    assert_file(168, "struct S{int pad;int a[8];int b[8];};int main(){struct S s;int n=8;int k=3;int t=0;for(int i=0;i<n;i++){s.a[i]=i*k+(n-1);s.b[i]=i;}int i=0;while(i<n){t=t+s.a[i]+s.b[i]*(k-2);i++;}return t;}");
+    assert_file(15, "int main(){int x=1;int y=2;int t=0;for(int i=0;i<3;i++){t=t+(x+y);x=x+1;}return t+(x+y)-3;}");
+    assert_file(6, "int main(){int x=1;int *p=&x;int t=0;for(int i=0;i<3;i++){t=t+(x+0*i)*1+x*0;*p=*p+1;}return t;}");
+    assert_file(190, "int main(){int a[20];for(int i=0;i<20;i++){a[i]=i;}int s=0;for(int i=0;i<20;i++){s+=a[i];}return s;}");
+    assert_file(90, "int main(){long b[10];int i;for(i=9;i>=0;i=i-1){b[i]=i*2;}int s=0;for(i=0;i<10;i+=2){s=s+b[i]+b[i+1];}return s+i-10;}");
+    assert_file(32, "int main(){int m[3][4];for(int i=0;i<3;i++)for(int j=0;j<4;j++)m[i][j]=i+j;int t=0;for(int i=0;i<3;i++){for(int j=0;j!=4;++j){t+=m[i][j];}}return t-8+*(&m[0][0]+11)*2;}");
+    assert_file(1, "int b[256];int main(){for(int i=0;i<256;i++){b[i]=i;}int s=0;for(unsigned char c=250;c!=4;c++)s+=b[c];return s==1521;}");
+    assert_file(1, "int wb[65536];int main(){for(int i=0;i<65536;i++){wb[i]=i;}long s=0;for(unsigned short c=65530;c!=5;c=c+1){s+=wb[c];}return s==393205;}");
+    assert_file(1, "int main(){int a[37];int b[37];int k=5;for(int i=0;i<37;i++){b[i]=i*3-50;}for(int i=0;i<37;i++){a[i]=(b[i]+k)^b[i];}int s=0;for(int i=0;i<37;i++){s+=a[i];}int t=0;for(int i=0;i<37;i++){t=t+((i*3-50+5)^(i*3-50));}return s==t;}");
+    assert_file(1, "int main(){unsigned char c[300];for(int i=0;i<300;i++){c[i]=i*7;}long s=0;for(int i=1;i<300;i++){s=s+c[i];}long t=0;for(int i=1;i<300;i=i+1){t=t+(i*7&255);}return s==t;}");
+    assert_file(1, "int main(){int a[50];for(int i=0;i<50;i++){a[i]=(i*37)%101-60;}int mx=-1000;int mn=1000;for(int i=0;i<50;i++){if(a[i]>mx)mx=a[i];}for(int i=0;i<50;i++){if(mn>a[i]){mn=a[i];}}return mx==40 && mn==-60;}");
+    assert_file(46, "int main(){char a[100];for(int i=0;i<100;i++){a[i]=1;}char *p=a+1;for(int i=0;i<99;i++){p[i]=a[i]+1;}return a[45];}");
+    assert_file(1, "inline int sum(int *a,int n){int s=0;for(int i=0;i<n;i++){s+=a[i];}if(n>32){s+=sum(a,n-32);}return s;}int main(){int a[100];for(int i=0;i<100;i++){a[i]=i;}return sum(a,100)==4950+2278+630+6;}");
+    assert_file(164, "int *mmap(int *a,long n,int prot,int flags,int fd,long off);int mprotect(int *a,long n,int prot);int sigaction(int sig,long *act,long *old);int *page;int faults;void on_segv(int sig,long *info,long *ctx){faults++;mprotect(page,4096,3);ctx[22]=ctx[22]|256;}void on_trap(int sig,long *info,long *ctx){mprotect(page,4096,0);ctx[22]=ctx[22]&~256;}int sum(volatile int *a,int n){int s=0;for(int i=0;i<n;i++){s=s+a[i];}return s;}int main(){long act[19];for(int i=0;i<19;i++){act[i]=0;}act[17]=4;act[0]=(long)&on_segv;sigaction(11,act,0);act[0]=(long)&on_trap;sigaction(5,act,0);page=mmap(0,4096,3,34,-1,0);for(int i=0;i<64;i++){page[i]=i;}mprotect(page,4096,0);int s=sum(page,64);mprotect(page,4096,3);return (s==2016)*100+faults;}");
+    assert_file(164, "int *mmap(int *a,long n,int prot,int flags,int fd,long off);int mprotect(int *a,long n,int prot);int sigaction(int sig,long *act,long *old);int *page;int faults;void on_segv(int sig,long *info,long *ctx){faults++;mprotect(page,4096,3);ctx[22]=ctx[22]|256;}void on_trap(int sig,long *info,long *ctx){mprotect(page,4096,0);ctx[22]=ctx[22]&~256;}void cp(volatile int *d,int *s,int n){for(int i=0;i<n;i++){d[i]=s[i];}}int main(){long act[19];for(int i=0;i<19;i++){act[i]=0;}act[17]=4;act[0]=(long)&on_segv;sigaction(11,act,0);act[0]=(long)&on_trap;sigaction(5,act,0);int b[64];for(int i=0;i<64;i++){b[i]=i;}page=mmap(0,4096,3,34,-1,0);mprotect(page,4096,0);cp(page,b,64);mprotect(page,4096,3);return (page[63]==63)*100+faults;}");
+    assert_file(7, "struct B{int b;int c;};struct A{struct B *a;};int f(struct A *p){return p->a->b+p->a->c;}int main(){struct B b;b.b=3;b.c=4;struct A s;s.a=&b;return f(&s);}");
+    assert_file(29, "int f(int *a,int i){int s=a[i]*a[i];a[i]=3;return s+a[i]*a[i+1];}int main(){int a[3];a[0]=4;a[1]=2;a[2]=3;return f(a,0)+f(a,1)-6;}");
+    assert_file(7, "int g;int *q;int f(int *p){int x=*p;*q=5;return x+*p;}int main(){int a=2;q=&a;return f(&a)+g;}");
+    assert_file(14, "int f(int *a,int i,int c){return c?a[i]+a[i]:a[i+1]*a[i+1];}int main(){int a[3];a[0]=1;a[1]=3;a[2]=4;int x=a[1];x+=a[1]*2;a[0]+=a[0]*2;return f(a,0,1)+f(a,0,0)+x-10;}");
+    assert_file(1, "long sum(long n,long acc){if(n==0)return acc;return sum(n-1,acc+n);}int main(){return sum(3000000,0)==4500001500000;}");
+    assert_file(1, "int odd(int n);int even(int n){if(n==0)return 1;return odd(n-1);}int odd(int n){if(n==0)return 0;return even(n-1);}int main(){return even(3000000)+odd(3000000);}");
+    assert_file(1, "int f(int *p,int n){if(n==0)return *p;int x=n;return f(&x,n-1);}int main(){int a=9;return f(&a,3);}");
+    assert_stdout(4, "7 8\n", "int printf(char *fmt, ...);int f(int x){return printf(\"%d %d\\n\",x,x+1);}int main(){return f(7);}");
+    assert_file(1, "int f(char c,short s){c=c+100;s++;return c==-56&&s==-32768;}int main(){return f(100,32767);}");
+    assert_file(1, "int sum(int *a,int n,int s){for(int i=0;i<n;i++)s+=a[i];return s;}int main(){int a[40];for(int i=0;i<40;i++)a[i]=i*3-20;return sum(a,40,7)==1547;}");
+    assert_file(55, "int g;int h(long x){g=g+x;return 0;}long f(long a,long b,long c,long d,long e){h(a);h(e);return a+b*2+c*3+d*4+e*5+g-6;}int main(){return f(1,2,3,4,5);}");
+    assert_file(6, "int f(int a,int *p){*p=a;a=a*2;return a;}int main(){int x;int y=f(2,&x);return x+y;}");
+    assert_file(10, "int aligned_call(int a);int main(){return aligned_call(1)+(2+(3+aligned_call(4)));}");
+    assert_file(15, "int aligned_call(int a);int f(int a,int b,int c){return a+b+c;}int g(int x){return f(aligned_call(x),aligned_call(2),aligned_call(3));}int main(){char c=1;return g(4)+f(1,1,aligned_call(c))+aligned_call(3);}");
+    assert_file(11, "int aligned_call(int a);int f(int n){int s=0;for(int i=0;i<n;i++){if(i%2){s+=aligned_call(i);}else{s=s+(1?aligned_call(i):0);}}return s;}int main(){return f(4)+(f(2)?aligned_call(5):0)+aligned_call(0);}");
+    assert_file(129, "long f(long a,int b,char c,short d,long e,int f,int h,char i,long j,int k){return a+b*2+c*3+d*4+e*5+f*6+h*7+i*8+j*9+k*10;}int main(){return f(1,2,3,4,5,6,7,8,9,10)-256;}");
+    assert_file(70, "int id(int x){return x;}int g=3;int seven(int a,int b,int c,int d,int e,int f,int h){return h*10+a;}int main(){int x=5;return seven(id(1),2,x,g,id(5),6,id(7))-seven(1,2,3,4,5,6,seven(0,2,3,4,5,6,id(0)));}");
+    assert_file(42, "int aligned_call(int a);int f(int a,int b,int c,int d,int e,int f,int g,int h){return a+b+c+d+e+f+g+h;}int main(){int k=1;return f(1,aligned_call(2),3,4,5,6,aligned_call(7),f(1,1,1,1,1,1,aligned_call(1),k+6));}");
+    assert_stdout(0, "1 2 3 4 5 6 7 eight\n", "int printf(char *fmt, ...);int g=6;int main(){int x=5;printf(\"%d %d %d %d %d %d %d %s\\n\",1,2,3,x-1,x,g,7,\"eight\");return 0;}");
+    assert_file(25, "struct S{long a;int b;char c[20];};int main(){struct S x;x.a=1;x.b=2;x.c[19]=7;x.c[0]=9;struct S y;y=x;struct S z=y;return z.a+z.b+z.c[19]+z.c[0]+(y.c[19]==7)*6;}");
+    assert_file(12, "struct S{char c[3];};struct U{struct S s[100];int z;};int main(){struct U u;u.s[99].c[2]=7;u.z=5;struct U v;v=u;struct S t=v.s[99];return t.c[2]+v.z;}");
+    assert_file(0, "int dirty(){int a[300];for(int i=0;i<300;i++)a[i]=i+1;return a[299];}int f(){int a[300]={1,2};long b[3]={0};char c[17]={1};int s=0;for(int i=2;i<300;i++)s+=a[i];return s+b[0]+b[2]+c[16]+(a[1]!=2);}int main(){dirty();return f();}");
+    assert_file(7, "struct P{int x;int y;int z;};int dirty(){int a[10];for(int i=0;i<10;i++)a[i]=i+1;return a[9];}int f(){struct P p={3,4};return p.x+p.y+p.z;}int main(){dirty();return f();}");
+    assert_file(0, "int dirty(){char a[500];for(int i=0;i<500;i++)a[i]=i+1;return a[99];}int f(){char buf[500]=\"hello, world\";int s=0;for(int i=12;i<500;i++)s+=buf[i];return s+(buf[0]!='h')+(buf[11]!='d');}int main(){dirty();return f();}");
+    assert_file(24, "int dirty(){int a[100];for(int i=0;i<100;i++)a[i]=i+1;return a[99];}int f(int k){int t[100]={1,2,3,-4,0,6,8};int s=0;for(int i=0;i<100;i++)s+=t[i];return s+t[6]+k-8;}int main(){dirty();return f(8);}");
+    assert_file(26, "struct P{int a;long b;char c[6];};int f(){struct P p={7,8,\"abc\"};return p.a+p.b+p.c[2]-p.c[1]+p.c[4]+10;}int main(){f();return f();}");
+    assert_file(6, "int f(int i){long t[4]={100,200,300,400};t[i]=0;return t[0]/100+t[1]/100+t[2]/100+t[3]/100;}int main(){f(0);return f(3);}");
+    assert_file(17, "const int tbl[8]={1,-2,3,0,0,0,0,15};int main(){return tbl[0]+tbl[1]+tbl[2]+tbl[7];}");
+    assert_file(9, "int zeros[1000];long big[4]={0,0,-1,0x123456789};int main(){zeros[999]=3;return zeros[999]+zeros[0]+big[0]+big[2]+(big[3]==0x123456789)*7;}");
+    assert_file(6, "struct S{char c;int i;short s;long l;};struct S gv={-3,5,-7,11};static int hidden=0;int main(){hidden++;return gv.c+gv.i+gv.s+gv.l+hidden-1;}");
+    assert_stdout(0, "b 2\n", "int printf(char *fmt, ...);const char *names[2]={\"a\",\"b\"};char buf[16];int main(){buf[0]='2';printf(\"%s %s\\n\",names[1],buf);return 0;}");
+    assert_file(1, "int main(){char *a=\"dup\";char *b=\"dup\";return a==b;}");
+    assert_file(1, "char *g(){return \"main\";}int main(){return g()==__func__;}");
+    assert_stdout(0, "x 98 main\n", "int printf(char *fmt, ...);char *p=\"x\";int main(){char *c=\"a\\0b\";printf(\"%s %d %s\\n\",p,c[2],__func__);return 0;}");
+    assert_file(8, "struct A{char c;int i;char d;};struct B{char c;long l;short s;};int main(){struct A a;struct B b;return sizeof(struct A)-sizeof(struct B)+(char*)&a.i-(char*)&a+(char*)&b.s-(char*)&b;}");
+    assert_file(4, "struct S{char c;short s;};struct S arr[5];int main(){arr[4].s=3;arr[3].c=1;return sizeof(arr)/5+(arr[4].s==3)*0;}");
+    assert_file(0, "struct __attribute__((aligned(64))) D{int a;};struct E{int a;}__attribute__((aligned(32)));struct D gd;_Alignas(32) int gi;int main(){return (long)&gd%64+(long)&gi%32+sizeof(struct D)-64+sizeof(struct E)-32;}");
+    assert_file(24, "struct C{char c;_Alignas(16) int x;};struct F{char c;int x __attribute__((aligned(8)));};int main(){struct C c;c.x=8;return sizeof(struct C)-sizeof(struct F)+c.x;}");
+    assert_file(0, "int main(){char c;long l;char d;int i;short s;return (long)&l%8+(long)&i%4+(long)&s%2;}");
+    assert_file(7, "void f(int *p) __attribute__((no_instrument_function));void f(int *p){*p=7;}int __attribute__((noinline, no_instrument_function)) main(){int x;f(&x);return x;}");
+    assert_file(5, "int backtrace(void **buf, int n);int count(){void *buf[64];return backtrace(buf,64);}int rec(int k){if(k==0)return count();return rec(k-1)+1;}int main(){return rec(5)-5-rec(0);}");
+    assert_file(3, "int backtrace(void **buf, int n);int count(){void *buf[64];return backtrace(buf,64);}int rec(int k,int a,int b,int c,int d,int e,int f,int g){int x[4];x[k%4]=k;if(k==0)return count();return rec(k-1,1,2,3,4,5,6,7)+x[k%4]-k;}int main(){return rec(3,0,0,0,0,0,0,0)-rec(0,0,0,0,0,0,0,0);}");
+    assert_file(125, "int g(int n){int s=0;for(int i=0;i<n;i++){if(__builtin_expect(i==3,0)){s+=100;continue;}if(__builtin_expect(i!=7,1))s+=i;else{s+=1000;break;}}return s;}int main(){return g(5)+g(10)-1100;}");
+    assert_file(5, "int backtrace(void **buf, int n);int count(){void *buf[64];return backtrace(buf,64);}int rec(int k){int x[2];x[k%2]=k;if(__builtin_expect(k==0,0))return count()+x[0];return rec(k-1)+1;}int main(){return rec(5)-5-rec(0);}");
+    assert_file(3, "void exit(int);void die2(int c) __attribute__((cold)) __attribute__((noreturn));void die2(int c){exit(c);}_Noreturn void die(int c){exit(c);}int main(){int x=3;if(x>5)die(1);if(__builtin_expect(x==4,0))die2(2);return __builtin_expect(x,3);}");
+    assert_file(1, "int main(){char c=0;short s=0;for(int i=0;i<200;i++){c++;s+=300;}return c==-56&&s==-5536;}");
+    assert_file(4, "int main(){unsigned char u=250;u+=10;_Bool b=0;for(int i=0;i<3;i++)b=i>1;return u+b-1;}");
+    assert_file(175, "int f(int n){int a=n*2;int b=n+1;int c=a+b;if(n==0)return 0;int r=f(n-1);return r+c;}int main(){int x=0,y=0;for(int i=0;i<2;i++){x=f(10);y+=i;}return x+y-1;}");
+    assert_file(6, "int gv;int hv;char cv;int main(){gv=gv+1;hv=gv*2;cv=300;int r=cv==44;gv++;++hv;return gv+hv+r;}");
+    assert_file(17, "int gv;void f(){gv+=7;}int main(){int *p=&gv;gv=1;*p=5;int a=gv;f();return a+gv;}");
+    assert_file(10, "int main(){int x=1;int *p=&x;x=2;*p=x+3;int y=x;(*p)++;return x+y-1;}");
+    assert_file(15, "int *mmap(int *a,long n,int prot,int flags,int fd,long off);int mprotect(int *a,long n,int prot);int sigaction(int sig,long *act,long *old);int *page;int faults;void on_segv(int sig,long *info,long *ctx){faults++;mprotect(page,4096,3);ctx[22]=ctx[22]|256;}void on_trap(int sig,long *info,long *ctx){mprotect(page,4096,0);ctx[22]=ctx[22]&~256;}int f(volatile int *p){return *p+*p;}int h(volatile int *p){*p=1;return *p;}int main(){long act[19];for(int i=0;i<19;i++){act[i]=0;}act[17]=4;act[0]=(long)&on_segv;sigaction(11,act,0);act[0]=(long)&on_trap;sigaction(5,act,0);page=mmap(0,4096,3,34,-1,0);page[0]=5;mprotect(page,4096,0);int a=f(page);int n=faults;int b=h(page);mprotect(page,4096,3);return (a==10)+(b==1)*2+(n==2)*4+(faults==4)*8;}");
+    assert_file(3, "int *mmap(int *a,long n,int prot,int flags,int fd,long off);int mprotect(int *a,long n,int prot);int sigaction(int sig,long *act,long *old);int *page;int faults;void on_segv(int sig,long *info,long *ctx){faults++;mprotect(page,4096,3);ctx[22]=ctx[22]|256;}void on_trap(int sig,long *info,long *ctx){mprotect(page,4096,0);ctx[22]=ctx[22]&~256;}_Alignas(4096) volatile int vg;int main(){long act[19];for(int i=0;i<19;i++){act[i]=0;}act[17]=4;act[0]=(long)&on_segv;sigaction(11,act,0);act[0]=(long)&on_trap;sigaction(5,act,0);page=(int *)&vg;vg=1;mprotect(page,4096,0);int a=vg*3+vg;int b=vg*3+vg;mprotect(page,4096,3);return (a+b==8)+(faults==4)*2;}");
     printf("OK\n");
     return 0;
 }
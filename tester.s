@@ -0,0 +1,7852 @@
+.intel_syntax noprefix
+.data
+.L_S_0:
+  .string "tmp.c"
+.L_S_1:
+  .string "w"
+.L_S_2:
+  .string "./rrcc -I/usr/include -I./include tmp.c > tmp.s"
+.L_S_3:
+  .string "cc -o tmp tmp.s calltest.c"
+.L_S_4:
+  .string "int main(){"
+.L_S_5:
+  .string "}"
+.L_S_6:
+  .string "Compile failed %s\n"
+.L_S_7:
+  .string "./tmp"
+.L_S_8:
+  .string "Execution failed. %s\n"
+.L_S_9:
+  .string "%s => %d\n"
+.L_S_10:
+  .string "%s => %d expected, but got %d\n"
+.L_S_11:
+  .string ""
+.L_S_12:
+  .string ""
+.L_S_13:
+  .string "Compile failed %s\n"
+.L_S_14:
+  .string "./tmp"
+.L_S_15:
+  .string "Execution failed. %s\n"
+.L_S_16:
+  .string "%s => %d\n"
+.L_S_17:
+  .string "%s => %d expected, but got %d\n"
+.L_S_18:
+  .string ""
+.L_S_19:
+  .string ""
+.L_S_20:
+  .string "OK: Compile failed %s\n"
+.L_S_21:
+  .string "%s => 'failed compilation' expected, but succeeded\n"
+.L_S_22:
+  .string ""
+.L_S_23:
+  .string ""
+.L_S_24:
+  .string "Compile failed %s\n"
+.L_S_25:
+  .string "./tmp > tmp.output"
+.L_S_26:
+  .string "Execution failed. %s\n"
+.L_S_27:
+  .string "tmp.output"
+.L_S_28:
+  .string "r"
+.L_S_29:
+  .string "%s => %d, %s\n"
+.L_S_30:
+  .string "%s => %d, '%s' expected, but got '%s'\n"
+.L_S_31:
+  .string "%s => %d expected, but got %d\n"
+.L_S_32:
+  .string "tmpinc.h"
+.L_S_33:
+  .string "w"
+.L_S_34:
+  .string ""
+.L_S_35:
+  .string ""
+.L_S_36:
+  .string "Compile failed %s\n"
+.L_S_37:
+  .string "./tmp"
+.L_S_38:
+  .string "Execution failed. %s\n"
+.L_S_39:
+  .string "%s => %d\n"
+.L_S_40:
+  .string "%s => %d expected, but got %d\n"
+.L_S_41:
+  .string "0;"
+.L_S_42:
+  .string "42;"
+.L_S_43:
+  .string "5+20-4;"
+.L_S_44:
+  .string " 12 + 34 - 5 ;"
+.L_S_45:
+  .string "1+2*3;"
+.L_S_46:
+  .string "(1+2)*3;"
+.L_S_47:
+  .string "5+6*7;"
+.L_S_48:
+  .string "5*(9-6);"
+.L_S_49:
+  .string "(3+5)/2;"
+.L_S_50:
+  .string "(3+5)/+2;"
+.L_S_51:
+  .string "-5*+2+16;"
+.L_S_52:
+  .string "10==10;"
+.L_S_53:
+  .string "10!=10;"
+.L_S_54:
+  .string "9<10;"
+.L_S_55:
+  .string "9<9;"
+.L_S_56:
+  .string "10<9;"
+.L_S_57:
+  .string "9<=10;"
+.L_S_58:
+  .string "9<=9;"
+.L_S_59:
+  .string "10<=9;"
+.L_S_60:
+  .string "10<=9==20<=19;"
+.L_S_61:
+  .string "1*1==20<=19;"
+.L_S_62:
+  .string "1*0==20<=19;"
+.L_S_63:
+  .string "int a;a=7;a*2;"
+.L_S_64:
+  .string "int a;a=10;a*2;"
+.L_S_65:
+  .string "int abc;abc=10;abc*3;"
+.L_S_66:
+  .string "int abc;int def;int ghi;abc=10;def=2*1;ghi=4+1;abc/ghi;"
+.L_S_67:
+  .string "int abc;int def;int ghi;abc=10;def=2*1;return ghi=4+1;abc/ghi;"
+.L_S_68:
+  .string "int a;int b;if(1){a=10;b=2;}else{a=1;b=9;}return a*b;"
+.L_S_69:
+  .string "int a;int b;if(0){a=10;b=2;}else{a=1;b=9;}return a*b;"
+.L_S_70:
+  .string "int a;int b;b=2;if(1)a=10;else{a=1;b=9;}return a*b;"
+.L_S_71:
+  .string "int b;int a;b=2;if(b==1)a=10;else{a=1;b=9;if(a=9){b=3;}}return a*b;"
+.L_S_72:
+  .string "int a;int b;b=0;for(a=0;a<10;a=a+1){b=b+a;}b;"
+.L_S_73:
+  .string "int a;int b;b=0;for(a=0;a==1;a=a+1){b=1;}b;"
+.L_S_74:
+  .string "int a;int b;a=0;b=32;while(b>0){b=b/2;a=a+b;}a;"
+.L_S_75:
+  .string "int a;a=0;do a=a+2; while(a<9);a;"
+.L_S_76:
+  .string "testfunc1 called!\n"
+.L_S_77:
+  .string "int testfunc1();int main(){testfunc1();}"
+.L_S_78:
+  .string "testfunc2,7,9 called!\n"
+.L_S_79:
+  .string "int testfunc2();int main(){testfunc2(1+6,9);}"
+.L_S_80:
+  .string "int tra(int a){if(a==1){return 1;}if(a==2){return 2;}return tra(a-1)+tra(a-2);}int main(){return tra(8);}"
+.L_S_81:
+  .string "int main(){int a;int *b;a=2;b=&a;a=3;return *b;}"
+.L_S_82:
+  .string "testfunc3,10,4 called!\n"
+.L_S_83:
+  .string "char *malloc(int size);int testfunc3(int *c);int main(){int *c;c=malloc(30);*c=10;*(c+1)=4;testfunc3(c);}"
+.L_S_84:
+  .string "testfunc3,1,2 called!\ntestfunc3,3,4 called!\n"
+.L_S_85:
+  .string "char *malloc(int size);int testfunc3(int *c);int main(){int **c;c=malloc(30);int *a;a=malloc(16);int *b;b=malloc(16);*c=a;*(c+1)=b;**c=1;*(a+1)=2;**(c+1)=3;*(b+1)=4;testfunc3(a);testfunc3(b);}"
+.L_S_86:
+  .string "int main(){int *a; 1+sizeof (*a);}"
+.L_S_87:
+  .string "int main(){int *a; 1+sizeof (a);}"
+.L_S_88:
+  .string "int main(){int *a; 1+sizeof (a+1);}"
+.L_S_89:
+  .string "int main(){int *a; 1+sizeof (a-1);}"
+.L_S_90:
+  .string "int main(){int *a; 1+sizeof (*a-1);}"
+.L_S_91:
+  .string "int main(){int *a;int *b; 1+sizeof (a-b);}"
+.L_S_92:
+  .string "int main(){int a[9];sizeof(a);}"
+.L_S_93:
+  .string "char *malloc(int size);int main(){int *a;int b;a=malloc(32);*a=1;*(a+1)=2;b=*(a+1);}"
+.L_S_94:
+  .string "char *malloc(int size);int main(){int *a;int b;int *c;a=malloc(32);c=a+2;*a=1;*(a+1)=2;b=*(a+1);c-a;}"
+.L_S_95:
+  .string "char *malloc(int size);int main(){int *a;int b;int *c;a=malloc(32);c=a+2;*a=7;*(a+1)=2;b=*(a+1);*(c-2);}"
+.L_S_96:
+  .string ""
+.L_S_97:
+  .string "char *malloc(int size);int natural_sub(int *a,int *c);int main(){int *a;int b;int *c;a=malloc(32);c=a+2;return natural_sub(c,a);}"
+.L_S_98:
+  .string "int main(){int a[2];*a=1;*(a+1)=2;return *a+*(a+1);}"
+.L_S_99:
+  .string "int main(){int a[2];*a=1;int c;c=a[0];}"
+.L_S_100:
+  .string "int main(){int a[2];*a=1;*(a+1)=3;int c;c=a[1];}"
+.L_S_101:
+  .string "int a;int b[10];int main(){a=1;b[0]=a;b[1]=b[0]+3;b[1];}"
+.L_S_102:
+  .string "char a;int main(){char b;b=2;a=b;a;}"
+.L_S_103:
+  .string "char a;char b;int main(){a=2;b=3;a;}"
+.L_S_104:
+  .string "char foo(char a){return a+1;}int main(){char a;a=2;return foo(a+1);}"
+.L_S_105:
+  .string "int main(){char a;return sizeof(a);}"
+.L_S_106:
+  .string "int main(){char a;return sizeof(a+1);}"
+.L_S_107:
+  .string "int main(){char a[7];return sizeof(a);}"
+.L_S_108:
+  .string "int main(){char *a;a=\"zbc\";a[2];}"
+.L_S_109:
+  .string "int main(){char *b;char *a;a=\"zbc\";b=\"zef\";b[0];}"
+.L_S_110:
+  .string "Hello world!"
+.L_S_111:
+  .string "int printf(char*f);int main(){printf(\"Hello world!\");}"
+.L_S_112:
+  .string "int main(){int a;a=1/*bb b */+1;return a;}"
+.L_S_113:
+  .string "int main(){// test comment\nint a;a=1\n///*bb b */\n+1;return a;}"
+.L_S_114:
+  .string "char a[2]=\"/\";int main(){char b[4]=\"g23\";a[0]+b[1];}"
+.L_S_115:
+  .string "int a[2]={10,20};int main(){return a[1];}"
+.L_S_116:
+  .string "int fun(){return 4;}int main(){int a[2]={fun(),fun()};return a[0]+a[1];}"
+.L_S_117:
+  .string "int fun(){return 4;}int main(){int a=fun();return a+1;}"
+.L_S_118:
+  .string "int *a[5];int main(){return sizeof(a);}"
+.L_S_119:
+  .string "int (*a)[5];int main(){return sizeof(a);}"
+.L_S_120:
+  .string "int (*a)[5];int main(){int b[5];a=&b;b[0]=2;return *a == b;}"
+.L_S_121:
+  .string "int (*a[2])[5];int main(){return sizeof(a);}"
+.L_S_122:
+  .string "int func(int a);int main(){return 1;}"
+.L_S_123:
+  .string "struct a{};int main(){return 1;}"
+.L_S_124:
+  .string "struct a{}b;int main(){return 1;}"
+.L_S_125:
+  .string "struct aa{int f;int q;int m;int *g;char p;}p;int main(){return sizeof(p);}"
+.L_S_126:
+  .string "int printf(char *s);struct st{int a;int b;}c;int main(){char *p=&c;c.a=1;c.b=7;return p[0]+p[4];}"
+.L_S_127:
+  .string "int printf(char *s);struct st{int a;int b;}c;int main(){struct st *q;q=&c;char *p=&c;q->a=2;q->b=9;return p[0]+c.b;}"
+.L_S_128:
+  .string "enum a{f,g,h};int main(){return g+h;}"
+.L_S_129:
+  .string "enum a{f=2,g,h=5};int main(){return g+h;}"
+.L_S_130:
+  .string "1 1 1"
+.L_S_131:
+  .string "int printf(char *s);enum a{f,g,h};int main(){enum a p;p=1;enum a q;q=g;printf(\"%d %d %d\", p, q, p==q);return sizeof(p);}"
+.L_S_132:
+  .string "int printf(char *s);typedef int *cp;int main(){int a[10]={3,4,5};cp p;p=a;return p[0];}"
+.L_S_133:
+  .string "int printf(char *s);typedef int *cp;int main(){cp p;return sizeof(*p)+sizeof(p);}"
+.L_S_134:
+  .string "int printf(char *s);typedef int ca[3];int main(){ca a={1,2,3};return sizeof(a)+a[1];}"
+.L_S_135:
+  .string "int printf(char *s);int main(){char s[3]=\"\\\"\";return s[0];}"
+.L_S_136:
+  .string "int printf(char *s);int main(){char s[3]=\"\\60\";return s[0];}"
+.L_S_137:
+  .string "int printf(char *s);int main(){char s[3]=\"\\x52\";return s[0];}"
+.L_S_138:
+  .string "b"
+.L_S_139:
+  .string "int putchar(char s);int main(){putchar('b');return '\\'';}"
+.L_S_140:
+  .string "o"
+.L_S_141:
+  .string "int putchar(char s);int main(){putchar('\\x6f');return '\"';}"
+.L_S_142:
+  .string "extern int printf(char *s);int main(){printf(\"\");return 10;}"
+.L_S_143:
+  .string "1"
+.L_S_144:
+  .string "int fprintf();int a;extern int *stderr;extern int *stdout;int main(){a=1;fprintf(stdout, \"%d\", a);return 0;}"
+.L_S_145:
+  .string "1"
+.L_S_146:
+  .string "int fprintf();int a;struct FILE {int dummy;};typedef struct FILE FILE;extern FILE *stderr;extern FILE *stdout;int main(){a=1;fprintf(stdout, \"%d\", a);return 0;}"
+.L_S_147:
+  .string "int fprintf();typedef struct S S;struct S {int a;};int main(){S a;a.a=1;return a.a;}"
+.L_S_148:
+  .string "#define M 10\nint main() { return M; }"
+.L_S_149:
+  .string "#define M 10+2\nint main() { return M*2; }"
+.L_S_150:
+  .string "#define M (10+2)\nint main() { return M*2; }"
+.L_S_151:
+  .string "#define M(a,b) a + b\nint main() { return M(3,5)*2; }"
+.L_S_152:
+  .string "#define M(a,b) a + b\nint main() { int a; a = 9; return M(3,5)*2; }"
+.L_S_153:
+  .string "#define M(c,b) a + b\nint main() { int a; a = 9; return M(3,5)*2; }"
+.L_S_154:
+  .string "#define N 2+2\n#define M(a) N * a\nint main() { return M(3); }"
+.L_S_155:
+  .string "#define P(a) (a* 3) \n#define N P(5)+2\n#define M(a) N * a\nint main() { return M(3); }"
+.L_S_156:
+  .string "#include <tmpinc.h>\nint main() { return func(4)+M(3); }"
+.L_S_157:
+  .string "int func(int n){return n+2;}\n#define M(a) (a-1)\n"
+.L_S_158:
+  .string "#include \"tmpinc.h\"\nint main() { return func(4)+M(3); }"
+.L_S_159:
+  .string "int func(int n){return n+2;}\n#define M(a) (a-1)\n"
+.L_S_160:
+  .string "#define H \"tmpinc.h\"\n#include H\nint main() { return func(4)+M(3); }"
+.L_S_161:
+  .string "int func(int n){return n+2;}\n#define M(a) (a-1)\n"
+.L_S_162:
+  .string "#define H 1\n#undef H\nint main(){return 0;}"
+.L_S_163:
+  .string "#define H 1\n#undef A\nint main(){return 0;}"
+.L_S_164:
+  .string "int main(){int a;a=2;\n#if 1\na=1;\n#endif\nreturn a;}"
+.L_S_165:
+  .string "int main(){int a;a=2;\n#if 0\na=1;\n#endif\nreturn a;}"
+.L_S_166:
+  .string "int main(){int a;a=2;\n#if 1\na=1;\n#else\na=3;\n#endif\nreturn a;}"
+.L_S_167:
+  .string "int main(){int a;a=2;\n#if 0\na=1;\n#else\na=3;\n#endif\nreturn a;}"
+.L_S_168:
+  .string "int main(){\n#define A 1\n#ifdef A\nreturn 1;\n#else\nreturn 0;\n#endif\n}"
+.L_S_169:
+  .string "int main(){\n#define A 1\n#ifdef B\nreturn 1;\n#else\nreturn 0;\n#endif\n}"
+.L_S_170:
+  .string "int main(){\n#define A 1\n#ifndef A\nreturn 1;\n#else\nreturn 0;\n#endif\n}"
+.L_S_171:
+  .string "int main(){\n#define A 1\n#ifndef B\nreturn 1;\n#else\nreturn 0;\n#endif\n}"
+.L_S_172:
+  .string "int main(){\n#define A 1-1\n#if A\nreturn 1;\n#else\nreturn 0;\n#endif\n}"
+.L_S_173:
+  .string "int main(){\n#define A 1-1*2\n#if A\nreturn 1;\n#else\nreturn 0;\n#endif\n}"
+.L_S_174:
+  .string "int main(){\n#define A 2*(3-3)\n#if A\nreturn 1;\n#else\nreturn 0;\n#endif\n}"
+.L_S_175:
+  .string "int main(){\n#define A 2 ?0:1\n#if A\nreturn 1;\n#else\nreturn 0;\n#endif\n}"
+.L_S_176:
+  .string "int main(){\n#define A 0 ?0:1\n#if A\nreturn 1;\n#else\nreturn 0;\n#endif\n}"
+.L_S_177:
+  .string "int main(){\n#define A C==0\n#if A\nreturn 1;\n#else\nreturn 0;\n#endif\n}"
+.L_S_178:
+  .string "int main(){}\n#if 1\n"
+.L_S_179:
+  .string "#if 1\n#endif\nint main(){return 1;}"
+.L_S_180:
+  .string "int main(){}\n#if 1\n#if 0\n#elif a\n#else\n#endif\n"
+.L_S_181:
+  .string "#define A\n#include \"tmpinc.h\"\nint main() { return func(4)+M(3); }"
+.L_S_182:
+  .string "#ifdef A\nint func(int n){return n+2;}\n#define M(a) (a-1)\n#endif"
+.L_S_183:
+  .string "#define A\n#define B\n#if defined A && defined B\nint main(){return 1;}\n#endif"
+.L_S_184:
+  .string "#define A 1\n#define B 2\n#define C(a,b) a ## b\nint main(){return C(A,B) == 12;}\n"
+.L_S_185:
+  .string "#define C 1 ## 2\nint main(){return C == 12;}\n"
+.L_S_186:
+  .string "c:t d: e:3"
+.L_S_187:
+  .string "int printf();\n#define C(a,b,...) printf(\"c:%s d:%s e:%d\", __VA_ARGS__);\nint main(){C(10,\"z\", \"t\", \"\", 3)return 1;}\n"
+.L_S_188:
+  .string "int main(){long int a = 0; return sizeof(a);}"
+.L_S_189:
+  .string "int main(){long a = 0; return sizeof(a);}"
+.L_S_190:
+  .string "int main(){short int a = 0; return sizeof(a);}"
+.L_S_191:
+  .string "int main(){short a = 0; return sizeof(a);}"
+.L_S_192:
+  .string "union a{int f;char g;};int main(){union a p; p.f=0;p.g=10; return sizeof(p);}"
+.L_S_193:
+  .string "union a{short f;char g;};int main(){union a p; p.f=0;p.g=10; return sizeof(p);}"
+.L_S_194:
+  .string "union a{short f;char g;};int main(){union a p; p.f=0;p.g=10; return p.g;}"
+.L_S_195:
+  .string "union a{short f;char g;};int main(){union a p; p.f=0;p.g=10; p.f=0; return p.g;}"
+.L_S_196:
+  .string "266"
+.L_S_197:
+  .string "int printf();union a{short f;char g;};int main(){union a p; p.f=300;p.g=10; printf(\"%d\", p.f); return 0;}"
+.L_S_198:
+  .string "char *const a;int main(){return sizeof(a);}"
+.L_S_199:
+  .string "char *restrict a;int main(){return sizeof(a);}"
+.L_S_200:
+  .string "char *volatile a;int main(){return sizeof(a);}"
+.L_S_201:
+  .string "char *const volatile restrict a;int main(){return sizeof(a);}"
+.L_S_202:
+  .string "char *const volatile restrict**const* a;int main(){return sizeof(a);}"
+.L_S_203:
+  .string "char *const volatile restrict**const* (*const a)[1];int main(){return sizeof(a);}"
+.L_S_204:
+  .string "int a(int a,...){}int b(...){}int main(){return 0;}"
+.L_S_205:
+  .string "int main(){return __STDC__;}"
+.L_S_206:
+  .string "#define M(a) a\nint main(){return M((1));}"
+.L_S_207:
+  .string "int main() {if(1&&1) {return 1;}else{return 0;}}"
+.L_S_208:
+  .string "int main() {if(1&&0) {return 1;}else{return 0;}}"
+.L_S_209:
+  .string "int main() {if(0&&1) {return 1;}else{return 0;}}"
+.L_S_210:
+  .string "int main() {if(0&&0) {return 1;}else{return 0;}}"
+.L_S_211:
+  .string "int main() {int a=1;if(1&&(a=2)) {}return a;}"
+.L_S_212:
+  .string "int main() {int a=1;if(0&&(a=2)) {}return a;}"
+.L_S_213:
+  .string "int main() {if(1||1) {return 1;}else{return 0;}}"
+.L_S_214:
+  .string "int main() {if(1||0) {return 1;}else{return 0;}}"
+.L_S_215:
+  .string "int main() {if(0||1) {return 1;}else{return 0;}}"
+.L_S_216:
+  .string "int main() {if(0||0) {return 1;}else{return 0;}}"
+.L_S_217:
+  .string "int main() {int a=1;if(1||(a=2)) {}return a;}"
+.L_S_218:
+  .string "int main() {int a=1;if(0||(a=2)) {}return a;}"
+.L_S_219:
+  .string "int main() {int a=(10&3); return a;}"
+.L_S_220:
+  .string "int main() {int a=(10|3); return a;}"
+.L_S_221:
+  .string "int main() {int a=(10^3); return a;}"
+.L_S_222:
+  .string "int main() {int a=(10 << 2); return a;}"
+.L_S_223:
+  .string "int main() {int a=(10 >> 2); return a;}"
+.L_S_224:
+  .string "int main() {int a;a=3;if(1){int a;a=4;}return a;}"
+.L_S_225:
+  .string "int main() {int a;a=3;if(1){int k;a=4;}return a;}"
+.L_S_226:
+  .string "int main() {int a;a=3;if(1){int k;k=4;}return a;}"
+.L_S_227:
+  .string "int main() {int a;a=3;if(1){int b;}int b;b=1;return a;}"
+.L_S_228:
+  .string "int main() {int a;if(1){int a;}int a;}"
+.L_S_229:
+  .string "int main() {int a;a=0;for(int i = 0; i < 3; i=i+1){a=a+i;}return a;}"
+.L_S_230:
+  .string "int main() {int a;a=0;for(int i = 0; i < 3; i=i+1){int i;a=a+1;}for(int i = 0; i < 3; i=i+1){a=a+i*2;}return a;}"
+.L_S_231:
+  .string "int main() {int a;a=0;for(int i = 0, j = 1; i < 3; i=i+j){int i;a=a+1;}for(int i = 0, j=3; i < 3; i=i+1){a=a+i*2;}return a;}"
+.L_S_232:
+  .string "int main() {char a;a=~2;return a;}"
+.L_S_233:
+  .string "int main() {int a;a=~9;return a==-10;}"
+.L_S_234:
+  .string "int main() {int a;a=1;int b;b=a++;return a;}"
+.L_S_235:
+  .string "int main() {int a;a=1;int b;b=a++;return b;}"
+.L_S_236:
+  .string "int main() {int v[2];v[0]=1;v[1]=2;int *a;a=v;a++;return *a;}"
+.L_S_237:
+  .string "struct A{int a;struct {int b;};};int main() {struct A f;f.b=10;f.a=9;return f.b;}"
+.L_S_238:
+  .string "int main() {char a[10-sizeof(int*)];return sizeof(a);}"
+.L_S_239:
+  .string "int main() {return sizeof(int [3]);}"
+.L_S_240:
+  .string "int main() {return sizeof(int *[3]);}"
+.L_S_241:
+  .string "int main() {int a=3;a ^= 1;return a;}"
+.L_S_242:
+  .string "int main() {int a=3;a += 5;return a;}"
+.L_S_243:
+  .string "int main() {int a=4;a *= 3;return a;}"
+.L_S_244:
+  .string "int main() {int a=7;a &= 10;return a;}"
+.L_S_245:
+  .string "int main() {int a=7;a |= 10;return a;}"
+.L_S_246:
+  .string "int main() {int a=7,b=0;b = a |= 10;return b;}"
+.L_S_247:
+  .string "int main() {return 12 % 5;}"
+.L_S_248:
+  .string "int main() {return 20 % 5;}"
+.L_S_249:
+  .string "int main() {return 2 % 1;}"
+.L_S_250:
+  .string "int main() {return 100 % 12;}"
+.L_S_251:
+  .string "int main() {int a=10,b=3;int c = a %= b; return c;}"
+.L_S_252:
+  .string "int main() {switch(1) {case 1: return 1; } return 0;}"
+.L_S_253:
+  .string "int main() {switch(2) {case 1: return 1; case 2: return 2; } return 0;}"
+.L_S_254:
+  .string "int main() {switch(2) {case 2: return 2; case 1: return 1; } return 0;}"
+.L_S_255:
+  .string "int main() {int a=0;switch(2) {case 3: a+=3; case 2: a+=2; case 1: a+=1; } return a;}"
+.L_S_256:
+  .string "int main() {int a=0;switch(4) {case 3: a+=3; case 2: a+=2; case 1: a+=1; } return a;}"
+.L_S_257:
+  .string "int main() {int a=0;switch(4) {case 3: a+=3; case 2: a+=2; default: case 1: a+=1; } return a;}"
+.L_S_258:
+  .string "int main() {int a=0;switch(3) {case 3: a+=3; break; case 2: a+=2; default: case 1: a+=1; } return a;}"
+.L_S_259:
+  .string "void fun(int *a){for(int i = 0; i < 10; i++){if(i==4){return;}*a+=i;}return;}int main() {int v=0;fun(&v);return v;}"
+.L_S_260:
+  .string "int main(){int a=0;int b=++a;return b;}"
+.L_S_261:
+  .string "int main(){int a=0;int b=++a;return a;}"
+.L_S_262:
+  .string "int main(){int a=2;int b=--a;return b;}"
+.L_S_263:
+  .string "int main(){int a=2;int b=3;int c=1;return c ? a : b;}"
+.L_S_264:
+  .string "int main(){int a=2;int b=3;int c=0;return c ? a : b;}"
+.L_S_265:
+  .string "int main(){return 1,2,3;}"
+.L_S_266:
+  .string "int main(){int a=0;return a=1,a=2,a+3;}"
+.L_S_267:
+  .string "int a=10;int main(){a+=2;return a;}"
+.L_S_268:
+  .string "#define a a\nint main(){int a=1;return a;}"
+.L_S_269:
+  .string "int a=1;int b=2;\n#define a b\n#define b a\nint main(){return a;}"
+.L_S_270:
+  .string "int g(int c,int d){return c*d;}int a=1;int b=2;\n#define f(a,b) g(a,b) + b\n#define g(a,b) f(a,b)\nint main(){return g(3,2);}"
+.L_S_271:
+  .string "int main(){int a=0;for(int i = 0; i < 10; i++){if(i==4){break;}a+=i;}return a;}"
+.L_S_272:
+  .string "int main(){int a=0;int i=0;while(1){if(i==4){break;}a+=i;i++;}return a;}"
+.L_S_273:
+  .string "int main(){int a=0;int i=0;do{if(i==4){break;}a+=i;i++;}while(1);return a;}"
+.L_S_274:
+  .string "int main(){int a=1;return !a;}"
+.L_S_275:
+  .string "int main(){int a=0;return !a;}"
+.L_S_276:
+  .string "struct A {int a;char b;};struct A p = {30, 40};int main(){return p.a+p.b;}"
+.L_S_277:
+  .string "tmp.c:1"
+.L_S_278:
+  .string "int printf(...);int main(){printf(\"%s:%d\", __FILE__, __LINE__);return 0;}"
+.L_S_279:
+  .string "tmp.c:2"
+.L_S_280:
+  .string "int printf(...);int main(){\nprintf(\"%s:%d\", __FILE__, __LINE__);return 0;}"
+.L_S_281:
+  .string "tmp.c:3"
+.L_S_282:
+  .string "int printf(...);int main(){\n\nprintf(\"%s:%d\", __FILE__, __LINE__);return 0;}"
+.L_S_283:
+  .string "#include <tmpinc.h>\nint main() { return func(); }"
+.L_S_284:
+  .string "\n\nint func(){return __LINE__;}\n"
+.L_S_285:
+  .string "main"
+.L_S_286:
+  .string "int printf(...);int main(){printf(\"%s\", __func__);return 0;}"
+.L_S_287:
+  .string "myfunc"
+.L_S_288:
+  .string "int printf(...);int myfunc(){printf(\"%s\", __func__);}int main(){myfunc();return 0;}"
+.L_S_289:
+  .string "int main(){int a = 0;for(int i = 0; i < 10; i++){if(i==3){i=8;continue;}a += i;}return a;}"
+.L_S_290:
+  .string "int main(){int a = 0;int i = 0;while(i < 10){if(i==3){i=8;continue;}a+=i;i++;}return a;}"
+.L_S_291:
+  .string "struct A {int a; char b[10];};struct A a={10, \"abc\"};int main(){return a.a + a.b[0];}"
+.L_S_292:
+  .string "struct A {int a; char *b;};struct A a={10, \"abc\"};int main(){return a.a + a.b[0];}"
+.L_S_293:
+  .string "struct A {int a; char b[10];};struct A a[]={{10, \"abc\"}, {3, \"def\"}};int main(){return a[0].a + a[1].b[0];}"
+.L_S_294:
+  .string "struct A {int a; char *b;};struct A a[]={{10, \"abc\"}, {3, \"def\"}};int main(){return a[0].a + a[1].b[0];}"
+.L_S_295:
+  .string "struct A {int a; char *b;};struct A a[]={{10, \"abc\"}, {3, \"def\"},};int main(){return a[0].a + a[1].b[0] + sizeof(a);}"
+.L_S_296:
+  .string "struct A {int a; char *b;};int main(){struct A a[]={{10, \"abc\"}, {3, \"def\"},};return a[0].a + a[1].b[0] + sizeof(a);}"
+.L_S_297:
+  .string "int strlen();int func(int a, char *p, char c, ...) {return a+strlen(p)+c;}int main(){return func(3,\"aaaa\",4);}"
+.L_S_298:
+  .string "aaaa:99 Hello va_list"
+.L_S_299:
+  .string "#define va_list __builtin_va_list\n#define va_start __builtin_va_start\n#define va_end __builtin_va_end\nint vprintf();int func(int a, char *p, char c, ...) {va_list ap;va_start(ap, c);vprintf(p, ap);va_end(ap);return sizeof(ap);}int main(){return func(3,\"aaaa:%d %s\",4,99,\"Hello va_list\");}"
+.L_S_300:
+  .string "int main(){int i = 0;int a=0; while(1){i++;int j = 0; while(1){j++;a+=j;if(j>=5)break;} if(i<3){continue;}break;}return a;}"
+.L_S_301:
+  .string "int main(){\n#ifdef __x86_64__\nreturn 1;\n#else\nreturn 2;\n#endif\n}"
+.L_S_302:
+  .string "#define A\n#ifdef A //aa\n#else\n#endif\nint main(){return 1;}"
+.L_S_303:
+  .string "int main(){char a;short b;return sizeof(a+b);}"
+.L_S_304:
+  .string "int main(){char a=20;char b=30;return (a*b) == 600;}"
+.L_S_305:
+  .string "int main(){char a=20;short b=30;return (a*b) == 600;}"
+.L_S_306:
+  .string "int main(){char a=20;int b=30;return (a*b) == 600;}"
+.L_S_307:
+  .string "int main(){char a=20;long b=30000000000L;return (a*b) == 600000000000;}"
+.L_S_308:
+  .string "int main(){long b=30000000000L;int a=b;return a == -64771072;}"
+.L_S_309:
+  .string "#include <string.h>\nint main(){int a=-839970252;unsigned char *p=(unsigned char*)&a;return memcmp(p, \"\\x34\\x12\\xef\\xcd\", 4) == 0;}"
+.L_S_310:
+  .string "#include <string.h>\nint main(){long a=35243;unsigned char *p=(unsigned char*)&a;return memcmp(p, \"\\xab\\x89\\x00\\x00\\x00\\x00\\x00\\x00\", 8) == 0;}"
+.L_S_311:
+  .string "#include <string.h>\nint main(){long a=-9223372036854775808;unsigned char *p=(unsigned char*)&a;return memcmp(p, \"\\x00\\x00\\x00\\x00\\x00\\x00\\x00\\x80\", 8) == 0;}"
+.L_S_312:
+  .string "#include <string.h>\nint main(){long a=4021214123015969202;unsigned char *p=(unsigned char*)&a;return memcmp(p, \"\\xb2\\x99\\x26\\x88\\xf0\\x38\\xce\\x37\", 8) == 0;}"
+.L_S_313:
+  .string "-16\n"
+.L_S_314:
+  .string "#include <stdio.h>\nint main(){signed char a=0xf0;short b = a;printf(\"%hd\\n\", b);return 0;}"
+.L_S_315:
+  .string "240\n"
+.L_S_316:
+  .string "#include <stdio.h>\nint main(){unsigned char a=0xf0;short b = a;printf(\"%hd\\n\", b);return 0;}"
+.L_S_317:
+  .string "61440\n"
+.L_S_318:
+  .string "#include <stdio.h>\nint main(){unsigned short a=0xf000;int b = a;printf(\"%d\\n\", b);return 0;}"
+.L_S_319:
+  .string "int main(){int *p=0x10000000000;int *q=0;return p==q;}"
+.L_S_320:
+  .string "int main(){long p=0x10000000000;int q=0;return p==q;}"
+.L_S_321:
+  .string "int main(){long p=0x10000000000;int q=1;return p!=q;}"
+.L_S_322:
+  .string "int main(){int *p=0x10000000000;void *q=(void *)1;return p > q;}"
+.L_S_323:
+  .string "int main(){int *p=0x10000000000;void *q=(void *)1;return q > p;}"
+.L_S_324:
+  .string "int main(){long p=0x10000000000;return (1L<<40)==p;}"
+.L_S_325:
+  .string "int main(){long p=0x10000000000;long r=0x30000000000;return (p|r)==r;}"
+.L_S_326:
+  .string "#include <stddef.h>\nstruct a{int c;char k;};int main(){return (offsetof(struct a,k)) == 4;}"
+.L_S_327:
+  .string "#include <stddef.h>\nint main(){char *p=0;return p == NULL;}"
+.L_S_328:
+  .string "#define ma() 1+\nint main(){return ma() 1;}"
+.L_S_329:
+  .string "int main(){return (-1-(1*2+3)/2+(2*3*(4/9*5+(1+2-4-(3+6))))) + ((10*10*10)/10) + (1*2*3*4*5/1/2/3/(22/11*9/4));}"
+.L_S_330:
+  .string "long p(int k){return (long)k * 100;}int main(){return p(1000000000) == 100000000000;}"
+.L_S_331:
+  .string "long p(int k){return k * 100;}int main(){return p(1000000000) != 100000000000;}"
+.L_S_332:
+  .string "int main(){long k=100000000000;return k == 100000000000;}"
+.L_S_333:
+  .string "int main(){long k=100000000000;return (int)k == 100000000000;}"
+.L_S_334:
+  .string "int main(){long k=100000000000;return (long)k == 100000000000;}"
+.L_S_335:
+  .string "int main(){long k=100000000000;return (long)(int)k == 100000000000;}"
+.L_S_336:
+  .string "int main(){int a[1+(int)sizeof(long)];return sizeof(a)==4*9;}"
+.L_S_337:
+  .string "int main(){int a[1+(char)(250+sizeof(long))];return sizeof(a)==4*3;}"
+.L_S_338:
+  .string "OK\n"
+  .file 1 "tester.c"
+  .loc 1 12
+  // tester.c:12
+.text
+.globl compile
+compile:
+  push rbp
+  push r15
+  push rbx
+  mov rbp,rsp
+  // allocate stack
+  sub rsp,40
+  // save argument 0: prefix
+  lea rax, [rbp-8]
+  push rax
+  push rdi
+  // type: * char
+  pop rbx
+  pop rax
+  mov qword ptr [rax], rbx
+  push rbx
+  pop rax
+  // save argument 1: source
+  lea rax, [rbp-16]
+  push rax
+  push rsi
+  // type: * char
+  pop rbx
+  pop rax
+  mov qword ptr [rax], rbx
+  push rbx
+  pop rax
+  // save argument 2: suffix
+  lea rax, [rbp-24]
+  push rax
+  push rdx
+  // type: * char
+  pop rbx
+  pop rax
+  mov qword ptr [rax], rbx
+  push rbx
+  pop rax
+  // scope
+  // scope
+  .loc 1 12
+  // tester.c:12
+  // compound 11
+  .loc 1 13
+  // tester.c:13
+  mov rax,0
+  push rax
+  pop rax
+  push rax
+  pop rax
+  .loc 1 14
+  // tester.c:14
+  mov rax,0
+  push rax
+  pop rax
+  push rax
+  pop rax
+  .loc 1 15
+  // tester.c:15
+  // access fp
+  mov rax, rbp
+  sub rax,36
+  push rax
+  lea rax, .L_S_0[rip]
+  push rax
+  lea rax, .L_S_1[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call fopen
+  mov rsp,r15
+  push rax
+  pop rbx
+  pop rax
+  mov qword ptr [rax], rbx
+  push rbx
+  pop rax
+  .loc 1 16
+  // tester.c:16
+  // access prefix
+  mov rax, rbp
+  sub rax,8
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  // access prefix
+  mov rax, rbp
+  sub rax,8
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call strlen
+  mov rsp,r15
+  push rax
+  mov rax, 1
+  push rax
+  // access fp
+  mov rax, rbp
+  sub rax,36
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rcx,rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call fwrite
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 17
+  // tester.c:17
+  // access source
+  mov rax, rbp
+  sub rax,16
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,16
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call strlen
+  mov rsp,r15
+  push rax
+  mov rax, 1
+  push rax
+  // access fp
+  mov rax, rbp
+  sub rax,36
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rcx,rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call fwrite
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 18
+  // tester.c:18
+  // access suffix
+  mov rax, rbp
+  sub rax,24
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  // access suffix
+  mov rax, rbp
+  sub rax,24
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call strlen
+  mov rsp,r15
+  push rax
+  mov rax, 1
+  push rax
+  // access fp
+  mov rax, rbp
+  sub rax,36
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rcx,rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call fwrite
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 19
+  // tester.c:19
+  // access fp
+  mov rax, rbp
+  sub rax,36
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call fclose
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 20
+  // tester.c:20
+  // access ret
+  mov rax, rbp
+  sub rax,28
+  push rax
+  lea rax, .L_S_2[rip]
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call system
+  mov rsp,r15
+  push rax
+  pop rbx
+  pop rax
+  mov dword ptr [rax], ebx
+  push rbx
+  pop rax
+  # if cond
+  .loc 1 21
+  // tester.c:21
+  // access ret
+  mov rax, rbp
+  sub rax,28
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  mov rax, 0
+  push rax
+  pop rsi
+  pop rax
+  cmp rax,rsi
+  setne al
+  movzb rax,al
+  push rax
+  pop rax
+  test rax,rax
+  jz .L1
+  # if stmt
+  // scope
+  .loc 1 21
+  // tester.c:21
+  // compound 1
+  .loc 1 22
+  // tester.c:22
+  // access ret
+  mov rax, rbp
+  sub rax,28
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  pop rax
+  mov rsp,rbp
+  pop rbx
+  pop r15
+  pop rbp
+  ret
+  pop rax
+  push rax
+  # else empty
+  jmp .L2
+.L1:
+  push 0  # dummy else statement
+.L2:
+  # if end
+  pop rax
+  .loc 1 24
+  // tester.c:24
+  // access ret
+  mov rax, rbp
+  sub rax,28
+  push rax
+  lea rax, .L_S_3[rip]
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call system
+  mov rsp,r15
+  push rax
+  pop rbx
+  pop rax
+  mov dword ptr [rax], ebx
+  push rbx
+  pop rax
+  # if cond
+  .loc 1 25
+  // tester.c:25
+  // access ret
+  mov rax, rbp
+  sub rax,28
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  mov rax, 0
+  push rax
+  pop rsi
+  pop rax
+  cmp rax,rsi
+  setne al
+  movzb rax,al
+  push rax
+  pop rax
+  test rax,rax
+  jz .L3
+  # if stmt
+  // scope
+  .loc 1 25
+  // tester.c:25
+  // compound 1
+  .loc 1 26
+  // tester.c:26
+  // access ret
+  mov rax, rbp
+  sub rax,28
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  pop rax
+  mov rsp,rbp
+  pop rbx
+  pop r15
+  pop rbp
+  ret
+  pop rax
+  push rax
+  # else empty
+  jmp .L4
+.L3:
+  push 0  # dummy else statement
+.L4:
+  # if end
+  pop rax
+  push rax
+  pop rax
+  mov rsp,rbp
+  pop rbx
+  pop r15
+  pop rbp
+  ret
+  .loc 1 30
+  // tester.c:30
+.text
+.globl assert
+assert:
+  push rbp
+  push r15
+  push rbx
+  mov rbp,rsp
+  // allocate stack
+  sub rsp,16
+  // save argument 0: expected
+  lea rax, [rbp-4]
+  push rax
+  push rdi
+  // type: signed int
+  pop rbx
+  pop rax
+  mov dword ptr [rax], ebx
+  push rbx
+  pop rax
+  // save argument 1: source
+  lea rax, [rbp-12]
+  push rax
+  push rsi
+  // type: * char
+  pop rbx
+  pop rax
+  mov qword ptr [rax], rbx
+  push rbx
+  pop rax
+  // scope
+  // scope
+  .loc 1 30
+  // tester.c:30
+  // compound 6
+  # if cond
+  .loc 1 31
+  // tester.c:31
+  lea rax, .L_S_4[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,12
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  lea rax, .L_S_5[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call compile
+  mov rsp,r15
+  push rax
+  pop rax
+  test rax,rax
+  jz .L5
+  # if stmt
+  // scope
+  .loc 1 31
+  // tester.c:31
+  // compound 2
+  .loc 1 32
+  // tester.c:32
+  lea rax, .L_S_6[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,12
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call printf
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 33
+  // tester.c:33
+  mov rax, 1
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call exit
+  mov rsp,r15
+  push rax
+  pop rax
+  push rax
+  # else empty
+  jmp .L6
+.L5:
+  push 0  # dummy else statement
+.L6:
+  # if end
+  pop rax
+  .loc 1 36
+  // tester.c:36
+  mov rax,0
+  push rax
+  pop rax
+  push rax
+  pop rax
+  .loc 1 37
+  // tester.c:37
+  // access ret
+  mov rax, rbp
+  sub rax,16
+  push rax
+  lea rax, .L_S_7[rip]
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call system
+  mov rsp,r15
+  push rax
+  pop rbx
+  pop rax
+  mov dword ptr [rax], ebx
+  push rbx
+  pop rax
+  # if cond
+  .loc 1 38
+  // tester.c:38
+  // access ret
+  mov rax, rbp
+  sub rax,16
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  mov rax, 0
+  push rax
+  mov rax, 1
+  push rax
+  pop rsi
+  pop rax
+  // sub
+  sub rax,rsi
+  push rax
+  pop rsi
+  pop rax
+  cmp rax,rsi
+  sete al
+  movzb rax,al
+  push rax
+  pop rax
+  test rax,rax
+  jz .L7
+  # if stmt
+  // scope
+  .loc 1 38
+  // tester.c:38
+  // compound 2
+  .loc 1 39
+  // tester.c:39
+  lea rax, .L_S_8[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,12
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call printf
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 40
+  // tester.c:40
+  mov rax, 1
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call exit
+  mov rsp,r15
+  push rax
+  pop rax
+  push rax
+  # else empty
+  jmp .L8
+.L7:
+  push 0  # dummy else statement
+.L8:
+  # if end
+  pop rax
+  .loc 1 42
+  // tester.c:42
+  // access ret
+  mov rax, rbp
+  sub rax,16
+  push rax
+  // access ret
+  mov rax, rbp
+  sub rax,16
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  mov rax, 256
+  push rax
+  pop rsi
+  pop rax
+  cqto
+  div rsi
+  push rax
+  // convert from signed int to signed int
+  pop rax
+  push rax
+  pop rbx
+  pop rax
+  mov dword ptr [rax], ebx
+  push rbx
+  pop rax
+  # if cond
+  .loc 1 44
+  // tester.c:44
+  // access ret
+  mov rax, rbp
+  sub rax,16
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  // access expected
+  mov rax, rbp
+  sub rax,4
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  pop rsi
+  pop rax
+  cmp rax,rsi
+  sete al
+  movzb rax,al
+  push rax
+  pop rax
+  test rax,rax
+  jz .L9
+  # if stmt
+  // scope
+  .loc 1 44
+  // tester.c:44
+  // compound 1
+  .loc 1 45
+  // tester.c:45
+  lea rax, .L_S_9[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,12
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  // access ret
+  mov rax, rbp
+  sub rax,16
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call printf
+  mov rsp,r15
+  push rax
+  pop rax
+  push rax
+  # else
+  jmp .L10
+.L9:
+  // scope
+  .loc 1 46
+  // tester.c:46
+  // compound 2
+  .loc 1 47
+  // tester.c:47
+  lea rax, .L_S_10[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,12
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  // access expected
+  mov rax, rbp
+  sub rax,4
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  // access ret
+  mov rax, rbp
+  sub rax,16
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  pop rax
+  mov rcx,rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call printf
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 48
+  // tester.c:48
+  mov rax, 1
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call exit
+  mov rsp,r15
+  push rax
+  pop rax
+  push rax
+.L10:
+  # if end
+  pop rax
+  push rax
+  pop rax
+  mov rsp,rbp
+  pop rbx
+  pop r15
+  pop rbp
+  ret
+  .loc 1 52
+  // tester.c:52
+.text
+.globl assert_file
+assert_file:
+  push rbp
+  push r15
+  push rbx
+  mov rbp,rsp
+  // allocate stack
+  sub rsp,16
+  // save argument 0: expected
+  lea rax, [rbp-4]
+  push rax
+  push rdi
+  // type: signed int
+  pop rbx
+  pop rax
+  mov dword ptr [rax], ebx
+  push rbx
+  pop rax
+  // save argument 1: source
+  lea rax, [rbp-12]
+  push rax
+  push rsi
+  // type: * char
+  pop rbx
+  pop rax
+  mov qword ptr [rax], rbx
+  push rbx
+  pop rax
+  // scope
+  // scope
+  .loc 1 52
+  // tester.c:52
+  // compound 6
+  # if cond
+  .loc 1 53
+  // tester.c:53
+  lea rax, .L_S_11[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,12
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  lea rax, .L_S_12[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call compile
+  mov rsp,r15
+  push rax
+  pop rax
+  test rax,rax
+  jz .L11
+  # if stmt
+  // scope
+  .loc 1 53
+  // tester.c:53
+  // compound 2
+  .loc 1 54
+  // tester.c:54
+  lea rax, .L_S_13[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,12
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call printf
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 55
+  // tester.c:55
+  mov rax, 1
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call exit
+  mov rsp,r15
+  push rax
+  pop rax
+  push rax
+  # else empty
+  jmp .L12
+.L11:
+  push 0  # dummy else statement
+.L12:
+  # if end
+  pop rax
+  .loc 1 58
+  // tester.c:58
+  mov rax,0
+  push rax
+  pop rax
+  push rax
+  pop rax
+  .loc 1 59
+  // tester.c:59
+  // access ret
+  mov rax, rbp
+  sub rax,16
+  push rax
+  lea rax, .L_S_14[rip]
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call system
+  mov rsp,r15
+  push rax
+  pop rbx
+  pop rax
+  mov dword ptr [rax], ebx
+  push rbx
+  pop rax
+  # if cond
+  .loc 1 60
+  // tester.c:60
+  // access ret
+  mov rax, rbp
+  sub rax,16
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  mov rax, 0
+  push rax
+  mov rax, 1
+  push rax
+  pop rsi
+  pop rax
+  // sub
+  sub rax,rsi
+  push rax
+  pop rsi
+  pop rax
+  cmp rax,rsi
+  sete al
+  movzb rax,al
+  push rax
+  pop rax
+  test rax,rax
+  jz .L13
+  # if stmt
+  // scope
+  .loc 1 60
+  // tester.c:60
+  // compound 2
+  .loc 1 61
+  // tester.c:61
+  lea rax, .L_S_15[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,12
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call printf
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 62
+  // tester.c:62
+  mov rax, 1
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call exit
+  mov rsp,r15
+  push rax
+  pop rax
+  push rax
+  # else empty
+  jmp .L14
+.L13:
+  push 0  # dummy else statement
+.L14:
+  # if end
+  pop rax
+  .loc 1 64
+  // tester.c:64
+  // access ret
+  mov rax, rbp
+  sub rax,16
+  push rax
+  // access ret
+  mov rax, rbp
+  sub rax,16
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  mov rax, 256
+  push rax
+  pop rsi
+  pop rax
+  cqto
+  div rsi
+  push rax
+  // convert from signed int to signed int
+  pop rax
+  push rax
+  pop rbx
+  pop rax
+  mov dword ptr [rax], ebx
+  push rbx
+  pop rax
+  # if cond
+  .loc 1 66
+  // tester.c:66
+  // access ret
+  mov rax, rbp
+  sub rax,16
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  // access expected
+  mov rax, rbp
+  sub rax,4
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  pop rsi
+  pop rax
+  cmp rax,rsi
+  sete al
+  movzb rax,al
+  push rax
+  pop rax
+  test rax,rax
+  jz .L15
+  # if stmt
+  // scope
+  .loc 1 66
+  // tester.c:66
+  // compound 1
+  .loc 1 67
+  // tester.c:67
+  lea rax, .L_S_16[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,12
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  // access ret
+  mov rax, rbp
+  sub rax,16
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call printf
+  mov rsp,r15
+  push rax
+  pop rax
+  push rax
+  # else
+  jmp .L16
+.L15:
+  // scope
+  .loc 1 68
+  // tester.c:68
+  // compound 2
+  .loc 1 69
+  // tester.c:69
+  lea rax, .L_S_17[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,12
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  // access expected
+  mov rax, rbp
+  sub rax,4
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  // access ret
+  mov rax, rbp
+  sub rax,16
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  pop rax
+  mov rcx,rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call printf
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 70
+  // tester.c:70
+  mov rax, 1
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call exit
+  mov rsp,r15
+  push rax
+  pop rax
+  push rax
+.L16:
+  # if end
+  pop rax
+  push rax
+  pop rax
+  mov rsp,rbp
+  pop rbx
+  pop r15
+  pop rbp
+  ret
+  .loc 1 74
+  // tester.c:74
+.text
+.globl assert_compile_fail
+assert_compile_fail:
+  push rbp
+  push r15
+  push rbx
+  mov rbp,rsp
+  // allocate stack
+  sub rsp,8
+  // save argument 0: source
+  lea rax, [rbp-8]
+  push rax
+  push rdi
+  // type: * char
+  pop rbx
+  pop rax
+  mov qword ptr [rax], rbx
+  push rbx
+  pop rax
+  // scope
+  // scope
+  .loc 1 74
+  // tester.c:74
+  // compound 3
+  # if cond
+  .loc 1 75
+  // tester.c:75
+  lea rax, .L_S_18[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,8
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  lea rax, .L_S_19[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call compile
+  mov rsp,r15
+  push rax
+  pop rax
+  test rax,rax
+  jz .L17
+  # if stmt
+  // scope
+  .loc 1 75
+  // tester.c:75
+  // compound 2
+  .loc 1 76
+  // tester.c:76
+  lea rax, .L_S_20[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,8
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call printf
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 77
+  // tester.c:77
+  mov rax, 0
+  push rax
+  pop rax
+  mov rsp,rbp
+  pop rbx
+  pop r15
+  pop rbp
+  ret
+  pop rax
+  push rax
+  # else empty
+  jmp .L18
+.L17:
+  push 0  # dummy else statement
+.L18:
+  # if end
+  pop rax
+  .loc 1 79
+  // tester.c:79
+  lea rax, .L_S_21[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,8
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call printf
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 80
+  // tester.c:80
+  mov rax, 1
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call exit
+  mov rsp,r15
+  push rax
+  pop rax
+  push rax
+  pop rax
+  mov rsp,rbp
+  pop rbx
+  pop r15
+  pop rbp
+  ret
+  .loc 1 83
+  // tester.c:83
+.text
+.globl assert_stdout
+assert_stdout:
+  push rbp
+  push r15
+  push rbx
+  mov rbp,rsp
+  // allocate stack
+  sub rsp,1032
+  // save argument 0: expected
+  lea rax, [rbp-4]
+  push rax
+  push rdi
+  // type: signed int
+  pop rbx
+  pop rax
+  mov dword ptr [rax], ebx
+  push rbx
+  pop rax
+  // save argument 1: str
+  lea rax, [rbp-12]
+  push rax
+  push rsi
+  // type: * char
+  pop rbx
+  pop rax
+  mov qword ptr [rax], rbx
+  push rbx
+  pop rax
+  // save argument 2: source
+  lea rax, [rbp-20]
+  push rax
+  push rdx
+  // type: * char
+  pop rbx
+  pop rax
+  mov qword ptr [rax], rbx
+  push rbx
+  pop rax
+  // scope
+  // scope
+  .loc 1 83
+  // tester.c:83
+  // compound 6
+  # if cond
+  .loc 1 84
+  // tester.c:84
+  lea rax, .L_S_22[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,20
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  lea rax, .L_S_23[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call compile
+  mov rsp,r15
+  push rax
+  pop rax
+  test rax,rax
+  jz .L19
+  # if stmt
+  // scope
+  .loc 1 84
+  // tester.c:84
+  // compound 2
+  .loc 1 85
+  // tester.c:85
+  lea rax, .L_S_24[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,20
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call printf
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 86
+  // tester.c:86
+  mov rax, 1
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call exit
+  mov rsp,r15
+  push rax
+  pop rax
+  push rax
+  # else empty
+  jmp .L20
+.L19:
+  push 0  # dummy else statement
+.L20:
+  # if end
+  pop rax
+  .loc 1 88
+  // tester.c:88
+  mov rax,0
+  push rax
+  pop rax
+  push rax
+  pop rax
+  .loc 1 89
+  // tester.c:89
+  // access ret
+  mov rax, rbp
+  sub rax,24
+  push rax
+  lea rax, .L_S_25[rip]
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call system
+  mov rsp,r15
+  push rax
+  pop rbx
+  pop rax
+  mov dword ptr [rax], ebx
+  push rbx
+  pop rax
+  # if cond
+  .loc 1 90
+  // tester.c:90
+  // access ret
+  mov rax, rbp
+  sub rax,24
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  mov rax, 0
+  push rax
+  mov rax, 1
+  push rax
+  pop rsi
+  pop rax
+  // sub
+  sub rax,rsi
+  push rax
+  pop rsi
+  pop rax
+  cmp rax,rsi
+  sete al
+  movzb rax,al
+  push rax
+  pop rax
+  test rax,rax
+  jz .L21
+  # if stmt
+  // scope
+  .loc 1 90
+  // tester.c:90
+  // compound 2
+  .loc 1 91
+  // tester.c:91
+  lea rax, .L_S_26[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,20
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call printf
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 92
+  // tester.c:92
+  mov rax, 1
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call exit
+  mov rsp,r15
+  push rax
+  pop rax
+  push rax
+  # else empty
+  jmp .L22
+.L21:
+  push 0  # dummy else statement
+.L22:
+  # if end
+  pop rax
+  .loc 1 94
+  // tester.c:94
+  // access ret
+  mov rax, rbp
+  sub rax,24
+  push rax
+  // access ret
+  mov rax, rbp
+  sub rax,24
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  mov rax, 256
+  push rax
+  pop rsi
+  pop rax
+  cqto
+  div rsi
+  push rax
+  // convert from signed int to signed int
+  pop rax
+  push rax
+  pop rbx
+  pop rax
+  mov dword ptr [rax], ebx
+  push rbx
+  pop rax
+  # if cond
+  .loc 1 96
+  // tester.c:96
+  // access ret
+  mov rax, rbp
+  sub rax,24
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  // access expected
+  mov rax, rbp
+  sub rax,4
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  pop rsi
+  pop rax
+  cmp rax,rsi
+  sete al
+  movzb rax,al
+  push rax
+  pop rax
+  test rax,rax
+  jz .L23
+  # if stmt
+  // scope
+  .loc 1 96
+  // tester.c:96
+  // compound 7
+  .loc 1 97
+  // tester.c:97
+  mov rax,0
+  push rax
+  pop rax
+  push rax
+  pop rax
+  .loc 1 98
+  // tester.c:98
+  mov rax,0
+  push rax
+  pop rax
+  push rax
+  pop rax
+  .loc 1 99
+  // tester.c:99
+  // access buf
+  mov rax, rbp
+  sub rax,1032
+  push rax
+  mov rax, 0
+  push rax
+  mov rax, 1000
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call memset
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 100
+  // tester.c:100
+  // access fp
+  mov rax, rbp
+  sub rax,32
+  push rax
+  lea rax, .L_S_27[rip]
+  push rax
+  lea rax, .L_S_28[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call fopen
+  mov rsp,r15
+  push rax
+  pop rbx
+  pop rax
+  mov qword ptr [rax], rbx
+  push rbx
+  pop rax
+  .loc 1 101
+  // tester.c:101
+  // access buf
+  mov rax, rbp
+  sub rax,1032
+  push rax
+  mov rax, 1000
+  push rax
+  mov rax, 1
+  push rax
+  // access fp
+  mov rax, rbp
+  sub rax,32
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rcx,rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call fread
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 102
+  // tester.c:102
+  // access fp
+  mov rax, rbp
+  sub rax,32
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call fclose
+  mov rsp,r15
+  push rax
+  pop rax
+  # if cond
+  .loc 1 103
+  // tester.c:103
+  // access buf
+  mov rax, rbp
+  sub rax,1032
+  push rax
+  // access str
+  mov rax, rbp
+  sub rax,12
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call strcmp
+  mov rsp,r15
+  push rax
+  mov rax, 0
+  push rax
+  pop rsi
+  pop rax
+  cmp rax,rsi
+  sete al
+  movzb rax,al
+  push rax
+  pop rax
+  test rax,rax
+  jz .L24
+  # if stmt
+  // scope
+  .loc 1 103
+  // tester.c:103
+  // compound 1
+  .loc 1 104
+  // tester.c:104
+  lea rax, .L_S_29[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,20
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  // access ret
+  mov rax, rbp
+  sub rax,24
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  // access str
+  mov rax, rbp
+  sub rax,12
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rcx,rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call printf
+  mov rsp,r15
+  push rax
+  pop rax
+  push rax
+  # else
+  jmp .L25
+.L24:
+  // scope
+  .loc 1 105
+  // tester.c:105
+  // compound 2
+  .loc 1 106
+  // tester.c:106
+  lea rax, .L_S_30[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,20
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  // access expected
+  mov rax, rbp
+  sub rax,4
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  // access str
+  mov rax, rbp
+  sub rax,12
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  // access buf
+  mov rax, rbp
+  sub rax,1032
+  push rax
+  pop rax
+  mov r8,rax
+  pop rax
+  mov rcx,rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call printf
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 107
+  // tester.c:107
+  mov rax, 1
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call exit
+  mov rsp,r15
+  push rax
+  pop rax
+  push rax
+.L25:
+  # if end
+  pop rax
+  push rax
+  # else
+  jmp .L26
+.L23:
+  // scope
+  .loc 1 109
+  // tester.c:109
+  // compound 2
+  .loc 1 110
+  // tester.c:110
+  lea rax, .L_S_31[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,20
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  // access expected
+  mov rax, rbp
+  sub rax,4
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  // access ret
+  mov rax, rbp
+  sub rax,24
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  pop rax
+  mov rcx,rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call printf
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 111
+  // tester.c:111
+  mov rax, 1
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call exit
+  mov rsp,r15
+  push rax
+  pop rax
+  push rax
+.L26:
+  # if end
+  pop rax
+  push rax
+  pop rax
+  mov rsp,rbp
+  pop rbx
+  pop r15
+  pop rbp
+  ret
+  .loc 1 115
+  // tester.c:115
+.text
+.globl assert_file_inc
+assert_file_inc:
+  push rbp
+  push r15
+  push rbx
+  mov rbp,rsp
+  // allocate stack
+  sub rsp,32
+  // save argument 0: expected
+  lea rax, [rbp-4]
+  push rax
+  push rdi
+  // type: signed int
+  pop rbx
+  pop rax
+  mov dword ptr [rax], ebx
+  push rbx
+  pop rax
+  // save argument 1: source
+  lea rax, [rbp-12]
+  push rax
+  push rsi
+  // type: * char
+  pop rbx
+  pop rax
+  mov qword ptr [rax], rbx
+  push rbx
+  pop rax
+  // save argument 2: inc_content
+  lea rax, [rbp-20]
+  push rax
+  push rdx
+  // type: * char
+  pop rbx
+  pop rax
+  mov qword ptr [rax], rbx
+  push rbx
+  pop rax
+  // scope
+  // scope
+  .loc 1 115
+  // tester.c:115
+  // compound 10
+  .loc 1 116
+  // tester.c:116
+  mov rax,0
+  push rax
+  pop rax
+  push rax
+  pop rax
+  .loc 1 117
+  // tester.c:117
+  // access fp
+  mov rax, rbp
+  sub rax,28
+  push rax
+  lea rax, .L_S_32[rip]
+  push rax
+  lea rax, .L_S_33[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call fopen
+  mov rsp,r15
+  push rax
+  pop rbx
+  pop rax
+  mov qword ptr [rax], rbx
+  push rbx
+  pop rax
+  .loc 1 118
+  // tester.c:118
+  // access inc_content
+  mov rax, rbp
+  sub rax,20
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  // access inc_content
+  mov rax, rbp
+  sub rax,20
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call strlen
+  mov rsp,r15
+  push rax
+  mov rax, 1
+  push rax
+  // access fp
+  mov rax, rbp
+  sub rax,28
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rcx,rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call fwrite
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 119
+  // tester.c:119
+  // access fp
+  mov rax, rbp
+  sub rax,28
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call fclose
+  mov rsp,r15
+  push rax
+  pop rax
+  # if cond
+  .loc 1 121
+  // tester.c:121
+  lea rax, .L_S_34[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,12
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  lea rax, .L_S_35[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call compile
+  mov rsp,r15
+  push rax
+  pop rax
+  test rax,rax
+  jz .L27
+  # if stmt
+  // scope
+  .loc 1 121
+  // tester.c:121
+  // compound 2
+  .loc 1 122
+  // tester.c:122
+  lea rax, .L_S_36[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,12
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call printf
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 123
+  // tester.c:123
+  mov rax, 1
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call exit
+  mov rsp,r15
+  push rax
+  pop rax
+  push rax
+  # else empty
+  jmp .L28
+.L27:
+  push 0  # dummy else statement
+.L28:
+  # if end
+  pop rax
+  .loc 1 126
+  // tester.c:126
+  mov rax,0
+  push rax
+  pop rax
+  push rax
+  pop rax
+  .loc 1 127
+  // tester.c:127
+  // access ret
+  mov rax, rbp
+  sub rax,32
+  push rax
+  lea rax, .L_S_37[rip]
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call system
+  mov rsp,r15
+  push rax
+  pop rbx
+  pop rax
+  mov dword ptr [rax], ebx
+  push rbx
+  pop rax
+  # if cond
+  .loc 1 128
+  // tester.c:128
+  // access ret
+  mov rax, rbp
+  sub rax,32
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  mov rax, 0
+  push rax
+  mov rax, 1
+  push rax
+  pop rsi
+  pop rax
+  // sub
+  sub rax,rsi
+  push rax
+  pop rsi
+  pop rax
+  cmp rax,rsi
+  sete al
+  movzb rax,al
+  push rax
+  pop rax
+  test rax,rax
+  jz .L29
+  # if stmt
+  // scope
+  .loc 1 128
+  // tester.c:128
+  // compound 2
+  .loc 1 129
+  // tester.c:129
+  lea rax, .L_S_38[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,12
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call printf
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 130
+  // tester.c:130
+  mov rax, 1
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call exit
+  mov rsp,r15
+  push rax
+  pop rax
+  push rax
+  # else empty
+  jmp .L30
+.L29:
+  push 0  # dummy else statement
+.L30:
+  # if end
+  pop rax
+  .loc 1 132
+  // tester.c:132
+  // access ret
+  mov rax, rbp
+  sub rax,32
+  push rax
+  // access ret
+  mov rax, rbp
+  sub rax,32
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  mov rax, 256
+  push rax
+  pop rsi
+  pop rax
+  cqto
+  div rsi
+  push rax
+  // convert from signed int to signed int
+  pop rax
+  push rax
+  pop rbx
+  pop rax
+  mov dword ptr [rax], ebx
+  push rbx
+  pop rax
+  # if cond
+  .loc 1 134
+  // tester.c:134
+  // access ret
+  mov rax, rbp
+  sub rax,32
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  // access expected
+  mov rax, rbp
+  sub rax,4
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  pop rsi
+  pop rax
+  cmp rax,rsi
+  sete al
+  movzb rax,al
+  push rax
+  pop rax
+  test rax,rax
+  jz .L31
+  # if stmt
+  // scope
+  .loc 1 134
+  // tester.c:134
+  // compound 1
+  .loc 1 135
+  // tester.c:135
+  lea rax, .L_S_39[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,12
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  // access ret
+  mov rax, rbp
+  sub rax,32
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call printf
+  mov rsp,r15
+  push rax
+  pop rax
+  push rax
+  # else
+  jmp .L32
+.L31:
+  // scope
+  .loc 1 136
+  // tester.c:136
+  // compound 2
+  .loc 1 137
+  // tester.c:137
+  lea rax, .L_S_40[rip]
+  push rax
+  // access source
+  mov rax, rbp
+  sub rax,12
+  push rax
+  pop rax
+  mov rax, qword ptr[rax]
+  push rax
+  // access expected
+  mov rax, rbp
+  sub rax,4
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  // access ret
+  mov rax, rbp
+  sub rax,32
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  pop rax
+  mov rcx,rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call printf
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 138
+  // tester.c:138
+  mov rax, 1
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call exit
+  mov rsp,r15
+  push rax
+  pop rax
+  push rax
+.L32:
+  # if end
+  pop rax
+  push rax
+  pop rax
+  mov rsp,rbp
+  pop rbx
+  pop r15
+  pop rbp
+  ret
+  .loc 1 143
+  // tester.c:143
+.text
+.globl main
+main:
+  push rbp
+  push r15
+  push rbx
+  mov rbp,rsp
+  // allocate stack
+  sub rsp,0
+  // scope
+  // scope
+  .loc 1 143
+  // tester.c:143
+  // compound 272
+  .loc 1 144
+  // tester.c:144
+  mov rax, 0
+  push rax
+  lea rax, .L_S_41[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 145
+  // tester.c:145
+  mov rax, 42
+  push rax
+  lea rax, .L_S_42[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 146
+  // tester.c:146
+  mov rax, 21
+  push rax
+  lea rax, .L_S_43[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 147
+  // tester.c:147
+  mov rax, 41
+  push rax
+  lea rax, .L_S_44[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 148
+  // tester.c:148
+  mov rax, 7
+  push rax
+  lea rax, .L_S_45[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 149
+  // tester.c:149
+  mov rax, 9
+  push rax
+  lea rax, .L_S_46[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 150
+  // tester.c:150
+  mov rax, 47
+  push rax
+  lea rax, .L_S_47[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 151
+  // tester.c:151
+  mov rax, 15
+  push rax
+  lea rax, .L_S_48[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 152
+  // tester.c:152
+  mov rax, 4
+  push rax
+  lea rax, .L_S_49[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 153
+  // tester.c:153
+  mov rax, 4
+  push rax
+  lea rax, .L_S_50[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 154
+  // tester.c:154
+  mov rax, 6
+  push rax
+  lea rax, .L_S_51[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 155
+  // tester.c:155
+  mov rax, 1
+  push rax
+  lea rax, .L_S_52[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 156
+  // tester.c:156
+  mov rax, 0
+  push rax
+  lea rax, .L_S_53[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 157
+  // tester.c:157
+  mov rax, 1
+  push rax
+  lea rax, .L_S_54[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 158
+  // tester.c:158
+  mov rax, 0
+  push rax
+  lea rax, .L_S_55[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 159
+  // tester.c:159
+  mov rax, 0
+  push rax
+  lea rax, .L_S_56[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 160
+  // tester.c:160
+  mov rax, 1
+  push rax
+  lea rax, .L_S_57[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 161
+  // tester.c:161
+  mov rax, 1
+  push rax
+  lea rax, .L_S_58[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 162
+  // tester.c:162
+  mov rax, 0
+  push rax
+  lea rax, .L_S_59[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 163
+  // tester.c:163
+  mov rax, 1
+  push rax
+  lea rax, .L_S_60[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 164
+  // tester.c:164
+  mov rax, 0
+  push rax
+  lea rax, .L_S_61[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 165
+  // tester.c:165
+  mov rax, 1
+  push rax
+  lea rax, .L_S_62[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 166
+  // tester.c:166
+  mov rax, 14
+  push rax
+  lea rax, .L_S_63[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 167
+  // tester.c:167
+  mov rax, 20
+  push rax
+  lea rax, .L_S_64[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 168
+  // tester.c:168
+  mov rax, 30
+  push rax
+  lea rax, .L_S_65[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 169
+  // tester.c:169
+  mov rax, 2
+  push rax
+  lea rax, .L_S_66[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 170
+  // tester.c:170
+  mov rax, 5
+  push rax
+  lea rax, .L_S_67[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 171
+  // tester.c:171
+  mov rax, 20
+  push rax
+  lea rax, .L_S_68[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 172
+  // tester.c:172
+  mov rax, 9
+  push rax
+  lea rax, .L_S_69[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 173
+  // tester.c:173
+  mov rax, 20
+  push rax
+  lea rax, .L_S_70[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 174
+  // tester.c:174
+  mov rax, 27
+  push rax
+  lea rax, .L_S_71[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 175
+  // tester.c:175
+  mov rax, 45
+  push rax
+  lea rax, .L_S_72[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 176
+  // tester.c:176
+  mov rax, 0
+  push rax
+  lea rax, .L_S_73[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 177
+  // tester.c:177
+  mov rax, 31
+  push rax
+  lea rax, .L_S_74[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 178
+  // tester.c:178
+  mov rax, 10
+  push rax
+  lea rax, .L_S_75[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 179
+  // tester.c:179
+  mov rax, 3
+  push rax
+  lea rax, .L_S_76[rip]
+  push rax
+  lea rax, .L_S_77[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_stdout
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 180
+  // tester.c:180
+  mov rax, 16
+  push rax
+  lea rax, .L_S_78[rip]
+  push rax
+  lea rax, .L_S_79[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_stdout
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 181
+  // tester.c:181
+  mov rax, 34
+  push rax
+  lea rax, .L_S_80[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 182
+  // tester.c:182
+  mov rax, 3
+  push rax
+  lea rax, .L_S_81[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 183
+  // tester.c:183
+  mov rax, 14
+  push rax
+  lea rax, .L_S_82[rip]
+  push rax
+  lea rax, .L_S_83[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_stdout
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 184
+  // tester.c:184
+  mov rax, 7
+  push rax
+  lea rax, .L_S_84[rip]
+  push rax
+  lea rax, .L_S_85[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_stdout
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 185
+  // tester.c:185
+  mov rax, 5
+  push rax
+  lea rax, .L_S_86[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 186
+  // tester.c:186
+  mov rax, 9
+  push rax
+  lea rax, .L_S_87[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 187
+  // tester.c:187
+  mov rax, 9
+  push rax
+  lea rax, .L_S_88[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 188
+  // tester.c:188
+  mov rax, 9
+  push rax
+  lea rax, .L_S_89[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 189
+  // tester.c:189
+  mov rax, 5
+  push rax
+  lea rax, .L_S_90[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 190
+  // tester.c:190
+  mov rax, 9
+  push rax
+  lea rax, .L_S_91[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 191
+  // tester.c:191
+  mov rax, 36
+  push rax
+  lea rax, .L_S_92[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 192
+  // tester.c:192
+  mov rax, 2
+  push rax
+  lea rax, .L_S_93[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 193
+  // tester.c:193
+  mov rax, 2
+  push rax
+  lea rax, .L_S_94[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 194
+  // tester.c:194
+  mov rax, 7
+  push rax
+  lea rax, .L_S_95[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 195
+  // tester.c:195
+  mov rax, 8
+  push rax
+  lea rax, .L_S_96[rip]
+  push rax
+  lea rax, .L_S_97[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_stdout
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 196
+  // tester.c:196
+  mov rax, 3
+  push rax
+  lea rax, .L_S_98[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 197
+  // tester.c:197
+  mov rax, 1
+  push rax
+  lea rax, .L_S_99[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 198
+  // tester.c:198
+  mov rax, 3
+  push rax
+  lea rax, .L_S_100[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 199
+  // tester.c:199
+  mov rax, 4
+  push rax
+  lea rax, .L_S_101[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 200
+  // tester.c:200
+  mov rax, 2
+  push rax
+  lea rax, .L_S_102[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 201
+  // tester.c:201
+  mov rax, 2
+  push rax
+  lea rax, .L_S_103[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 202
+  // tester.c:202
+  mov rax, 4
+  push rax
+  lea rax, .L_S_104[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 203
+  // tester.c:203
+  mov rax, 1
+  push rax
+  lea rax, .L_S_105[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 204
+  // tester.c:204
+  mov rax, 4
+  push rax
+  lea rax, .L_S_106[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 205
+  // tester.c:205
+  mov rax, 7
+  push rax
+  lea rax, .L_S_107[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 206
+  // tester.c:206
+  mov rax, 99
+  push rax
+  lea rax, .L_S_108[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 207
+  // tester.c:207
+  mov rax, 122
+  push rax
+  lea rax, .L_S_109[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 208
+  // tester.c:208
+  mov rax, 12
+  push rax
+  lea rax, .L_S_110[rip]
+  push rax
+  lea rax, .L_S_111[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_stdout
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 209
+  // tester.c:209
+  mov rax, 2
+  push rax
+  lea rax, .L_S_112[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 210
+  // tester.c:210
+  mov rax, 2
+  push rax
+  lea rax, .L_S_113[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 211
+  // tester.c:211
+  mov rax, 97
+  push rax
+  lea rax, .L_S_114[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 212
+  // tester.c:212
+  mov rax, 20
+  push rax
+  lea rax, .L_S_115[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 213
+  // tester.c:213
+  mov rax, 8
+  push rax
+  lea rax, .L_S_116[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 214
+  // tester.c:214
+  mov rax, 5
+  push rax
+  lea rax, .L_S_117[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 215
+  // tester.c:215
+  mov rax, 40
+  push rax
+  lea rax, .L_S_118[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 216
+  // tester.c:216
+  mov rax, 8
+  push rax
+  lea rax, .L_S_119[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 217
+  // tester.c:217
+  mov rax, 1
+  push rax
+  lea rax, .L_S_120[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 218
+  // tester.c:218
+  mov rax, 16
+  push rax
+  lea rax, .L_S_121[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 219
+  // tester.c:219
+  mov rax, 1
+  push rax
+  lea rax, .L_S_122[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 220
+  // tester.c:220
+  mov rax, 1
+  push rax
+  lea rax, .L_S_123[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 221
+  // tester.c:221
+  mov rax, 1
+  push rax
+  lea rax, .L_S_124[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 222
+  // tester.c:222
+  mov rax, 21
+  push rax
+  lea rax, .L_S_125[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 223
+  // tester.c:223
+  mov rax, 8
+  push rax
+  lea rax, .L_S_126[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 224
+  // tester.c:224
+  mov rax, 11
+  push rax
+  lea rax, .L_S_127[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 225
+  // tester.c:225
+  mov rax, 3
+  push rax
+  lea rax, .L_S_128[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 226
+  // tester.c:226
+  mov rax, 8
+  push rax
+  lea rax, .L_S_129[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 227
+  // tester.c:227
+  mov rax, 4
+  push rax
+  lea rax, .L_S_130[rip]
+  push rax
+  lea rax, .L_S_131[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_stdout
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 228
+  // tester.c:228
+  mov rax, 3
+  push rax
+  lea rax, .L_S_132[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 229
+  // tester.c:229
+  mov rax, 12
+  push rax
+  lea rax, .L_S_133[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 230
+  // tester.c:230
+  mov rax, 14
+  push rax
+  lea rax, .L_S_134[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 231
+  // tester.c:231
+  mov rax, 34
+  push rax
+  lea rax, .L_S_135[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 232
+  // tester.c:232
+  mov rax, 48
+  push rax
+  lea rax, .L_S_136[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 233
+  // tester.c:233
+  mov rax, 82
+  push rax
+  lea rax, .L_S_137[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 234
+  // tester.c:234
+  mov rax, 39
+  push rax
+  lea rax, .L_S_138[rip]
+  push rax
+  lea rax, .L_S_139[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_stdout
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 235
+  // tester.c:235
+  mov rax, 34
+  push rax
+  lea rax, .L_S_140[rip]
+  push rax
+  lea rax, .L_S_141[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_stdout
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 236
+  // tester.c:236
+  mov rax, 10
+  push rax
+  lea rax, .L_S_142[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 237
+  // tester.c:237
+  mov rax, 0
+  push rax
+  lea rax, .L_S_143[rip]
+  push rax
+  lea rax, .L_S_144[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_stdout
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 238
+  // tester.c:238
+  mov rax, 0
+  push rax
+  lea rax, .L_S_145[rip]
+  push rax
+  lea rax, .L_S_146[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_stdout
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 239
+  // tester.c:239
+  mov rax, 1
+  push rax
+  lea rax, .L_S_147[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 240
+  // tester.c:240
+  mov rax, 10
+  push rax
+  lea rax, .L_S_148[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 241
+  // tester.c:241
+  mov rax, 14
+  push rax
+  lea rax, .L_S_149[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 242
+  // tester.c:242
+  mov rax, 24
+  push rax
+  lea rax, .L_S_150[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 243
+  // tester.c:243
+  mov rax, 13
+  push rax
+  lea rax, .L_S_151[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 244
+  // tester.c:244
+  mov rax, 13
+  push rax
+  lea rax, .L_S_152[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 245
+  // tester.c:245
+  mov rax, 19
+  push rax
+  lea rax, .L_S_153[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 246
+  // tester.c:246
+  mov rax, 8
+  push rax
+  lea rax, .L_S_154[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 247
+  // tester.c:247
+  mov rax, 21
+  push rax
+  lea rax, .L_S_155[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 248
+  // tester.c:248
+  mov rax, 8
+  push rax
+  lea rax, .L_S_156[rip]
+  push rax
+  lea rax, .L_S_157[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file_inc
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 249
+  // tester.c:249
+  mov rax, 8
+  push rax
+  lea rax, .L_S_158[rip]
+  push rax
+  lea rax, .L_S_159[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file_inc
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 250
+  // tester.c:250
+  mov rax, 8
+  push rax
+  lea rax, .L_S_160[rip]
+  push rax
+  lea rax, .L_S_161[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file_inc
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 251
+  // tester.c:251
+  mov rax, 0
+  push rax
+  lea rax, .L_S_162[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 252
+  // tester.c:252
+  mov rax, 0
+  push rax
+  lea rax, .L_S_163[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 253
+  // tester.c:253
+  mov rax, 1
+  push rax
+  lea rax, .L_S_164[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 254
+  // tester.c:254
+  mov rax, 2
+  push rax
+  lea rax, .L_S_165[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 255
+  // tester.c:255
+  mov rax, 1
+  push rax
+  lea rax, .L_S_166[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 256
+  // tester.c:256
+  mov rax, 3
+  push rax
+  lea rax, .L_S_167[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 257
+  // tester.c:257
+  mov rax, 1
+  push rax
+  lea rax, .L_S_168[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 258
+  // tester.c:258
+  mov rax, 0
+  push rax
+  lea rax, .L_S_169[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 259
+  // tester.c:259
+  mov rax, 0
+  push rax
+  lea rax, .L_S_170[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 260
+  // tester.c:260
+  mov rax, 1
+  push rax
+  lea rax, .L_S_171[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 261
+  // tester.c:261
+  mov rax, 0
+  push rax
+  lea rax, .L_S_172[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 262
+  // tester.c:262
+  mov rax, 1
+  push rax
+  lea rax, .L_S_173[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 263
+  // tester.c:263
+  mov rax, 0
+  push rax
+  lea rax, .L_S_174[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 264
+  // tester.c:264
+  mov rax, 0
+  push rax
+  lea rax, .L_S_175[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 265
+  // tester.c:265
+  mov rax, 1
+  push rax
+  lea rax, .L_S_176[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 266
+  // tester.c:266
+  mov rax, 1
+  push rax
+  lea rax, .L_S_177[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 267
+  // tester.c:267
+  lea rax, .L_S_178[rip]
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_compile_fail
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 268
+  // tester.c:268
+  mov rax, 1
+  push rax
+  lea rax, .L_S_179[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 269
+  // tester.c:269
+  lea rax, .L_S_180[rip]
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_compile_fail
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 270
+  // tester.c:270
+  mov rax, 8
+  push rax
+  lea rax, .L_S_181[rip]
+  push rax
+  lea rax, .L_S_182[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file_inc
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 271
+  // tester.c:271
+  mov rax, 1
+  push rax
+  lea rax, .L_S_183[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 272
+  // tester.c:272
+  mov rax, 1
+  push rax
+  lea rax, .L_S_184[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 273
+  // tester.c:273
+  mov rax, 1
+  push rax
+  lea rax, .L_S_185[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 274
+  // tester.c:274
+  mov rax, 1
+  push rax
+  lea rax, .L_S_186[rip]
+  push rax
+  lea rax, .L_S_187[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_stdout
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 275
+  // tester.c:275
+  mov rax, 8
+  push rax
+  lea rax, .L_S_188[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 276
+  // tester.c:276
+  mov rax, 8
+  push rax
+  lea rax, .L_S_189[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 277
+  // tester.c:277
+  mov rax, 2
+  push rax
+  lea rax, .L_S_190[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 278
+  // tester.c:278
+  mov rax, 2
+  push rax
+  lea rax, .L_S_191[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 279
+  // tester.c:279
+  mov rax, 4
+  push rax
+  lea rax, .L_S_192[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 280
+  // tester.c:280
+  mov rax, 2
+  push rax
+  lea rax, .L_S_193[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 281
+  // tester.c:281
+  mov rax, 10
+  push rax
+  lea rax, .L_S_194[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 282
+  // tester.c:282
+  mov rax, 0
+  push rax
+  lea rax, .L_S_195[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 283
+  // tester.c:283
+  mov rax, 0
+  push rax
+  lea rax, .L_S_196[rip]
+  push rax
+  lea rax, .L_S_197[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_stdout
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 284
+  // tester.c:284
+  mov rax, 8
+  push rax
+  lea rax, .L_S_198[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 285
+  // tester.c:285
+  mov rax, 8
+  push rax
+  lea rax, .L_S_199[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 286
+  // tester.c:286
+  mov rax, 8
+  push rax
+  lea rax, .L_S_200[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 287
+  // tester.c:287
+  mov rax, 8
+  push rax
+  lea rax, .L_S_201[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 288
+  // tester.c:288
+  mov rax, 8
+  push rax
+  lea rax, .L_S_202[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 289
+  // tester.c:289
+  mov rax, 8
+  push rax
+  lea rax, .L_S_203[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 290
+  // tester.c:290
+  mov rax, 0
+  push rax
+  lea rax, .L_S_204[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 291
+  // tester.c:291
+  mov rax, 1
+  push rax
+  lea rax, .L_S_205[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 292
+  // tester.c:292
+  mov rax, 1
+  push rax
+  lea rax, .L_S_206[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 293
+  // tester.c:293
+  mov rax, 1
+  push rax
+  lea rax, .L_S_207[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 294
+  // tester.c:294
+  mov rax, 0
+  push rax
+  lea rax, .L_S_208[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 295
+  // tester.c:295
+  mov rax, 0
+  push rax
+  lea rax, .L_S_209[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 296
+  // tester.c:296
+  mov rax, 0
+  push rax
+  lea rax, .L_S_210[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 297
+  // tester.c:297
+  mov rax, 2
+  push rax
+  lea rax, .L_S_211[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 298
+  // tester.c:298
+  mov rax, 1
+  push rax
+  lea rax, .L_S_212[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 299
+  // tester.c:299
+  mov rax, 1
+  push rax
+  lea rax, .L_S_213[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 300
+  // tester.c:300
+  mov rax, 1
+  push rax
+  lea rax, .L_S_214[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 301
+  // tester.c:301
+  mov rax, 1
+  push rax
+  lea rax, .L_S_215[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 302
+  // tester.c:302
+  mov rax, 0
+  push rax
+  lea rax, .L_S_216[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 303
+  // tester.c:303
+  mov rax, 1
+  push rax
+  lea rax, .L_S_217[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 304
+  // tester.c:304
+  mov rax, 2
+  push rax
+  lea rax, .L_S_218[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 305
+  // tester.c:305
+  mov rax, 2
+  push rax
+  lea rax, .L_S_219[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 306
+  // tester.c:306
+  mov rax, 11
+  push rax
+  lea rax, .L_S_220[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 307
+  // tester.c:307
+  mov rax, 9
+  push rax
+  lea rax, .L_S_221[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 308
+  // tester.c:308
+  mov rax, 40
+  push rax
+  lea rax, .L_S_222[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 309
+  // tester.c:309
+  mov rax, 2
+  push rax
+  lea rax, .L_S_223[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 310
+  // tester.c:310
+  mov rax, 3
+  push rax
+  lea rax, .L_S_224[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 311
+  // tester.c:311
+  mov rax, 4
+  push rax
+  lea rax, .L_S_225[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 312
+  // tester.c:312
+  mov rax, 3
+  push rax
+  lea rax, .L_S_226[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 313
+  // tester.c:313
+  mov rax, 3
+  push rax
+  lea rax, .L_S_227[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 314
+  // tester.c:314
+  lea rax, .L_S_228[rip]
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_compile_fail
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 315
+  // tester.c:315
+  mov rax, 3
+  push rax
+  lea rax, .L_S_229[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 316
+  // tester.c:316
+  mov rax, 9
+  push rax
+  lea rax, .L_S_230[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 317
+  // tester.c:317
+  mov rax, 9
+  push rax
+  lea rax, .L_S_231[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 318
+  // tester.c:318
+  mov rax, 253
+  push rax
+  lea rax, .L_S_232[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 319
+  // tester.c:319
+  mov rax, 1
+  push rax
+  lea rax, .L_S_233[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 320
+  // tester.c:320
+  mov rax, 2
+  push rax
+  lea rax, .L_S_234[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 321
+  // tester.c:321
+  mov rax, 1
+  push rax
+  lea rax, .L_S_235[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 322
+  // tester.c:322
+  mov rax, 2
+  push rax
+  lea rax, .L_S_236[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 323
+  // tester.c:323
+  mov rax, 10
+  push rax
+  lea rax, .L_S_237[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 324
+  // tester.c:324
+  mov rax, 2
+  push rax
+  lea rax, .L_S_238[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 325
+  // tester.c:325
+  mov rax, 12
+  push rax
+  lea rax, .L_S_239[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 326
+  // tester.c:326
+  mov rax, 24
+  push rax
+  lea rax, .L_S_240[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 327
+  // tester.c:327
+  mov rax, 2
+  push rax
+  lea rax, .L_S_241[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 328
+  // tester.c:328
+  mov rax, 8
+  push rax
+  lea rax, .L_S_242[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 329
+  // tester.c:329
+  mov rax, 12
+  push rax
+  lea rax, .L_S_243[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 330
+  // tester.c:330
+  mov rax, 2
+  push rax
+  lea rax, .L_S_244[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 331
+  // tester.c:331
+  mov rax, 15
+  push rax
+  lea rax, .L_S_245[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 332
+  // tester.c:332
+  mov rax, 15
+  push rax
+  lea rax, .L_S_246[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 333
+  // tester.c:333
+  mov rax, 2
+  push rax
+  lea rax, .L_S_247[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 334
+  // tester.c:334
+  mov rax, 0
+  push rax
+  lea rax, .L_S_248[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 335
+  // tester.c:335
+  mov rax, 0
+  push rax
+  lea rax, .L_S_249[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 336
+  // tester.c:336
+  mov rax, 4
+  push rax
+  lea rax, .L_S_250[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 337
+  // tester.c:337
+  mov rax, 1
+  push rax
+  lea rax, .L_S_251[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 338
+  // tester.c:338
+  mov rax, 1
+  push rax
+  lea rax, .L_S_252[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 339
+  // tester.c:339
+  mov rax, 2
+  push rax
+  lea rax, .L_S_253[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 340
+  // tester.c:340
+  mov rax, 2
+  push rax
+  lea rax, .L_S_254[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 341
+  // tester.c:341
+  mov rax, 3
+  push rax
+  lea rax, .L_S_255[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 342
+  // tester.c:342
+  mov rax, 0
+  push rax
+  lea rax, .L_S_256[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 343
+  // tester.c:343
+  mov rax, 1
+  push rax
+  lea rax, .L_S_257[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 344
+  // tester.c:344
+  mov rax, 3
+  push rax
+  lea rax, .L_S_258[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 345
+  // tester.c:345
+  mov rax, 6
+  push rax
+  lea rax, .L_S_259[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 346
+  // tester.c:346
+  mov rax, 1
+  push rax
+  lea rax, .L_S_260[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 347
+  // tester.c:347
+  mov rax, 1
+  push rax
+  lea rax, .L_S_261[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 348
+  // tester.c:348
+  mov rax, 1
+  push rax
+  lea rax, .L_S_262[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 349
+  // tester.c:349
+  mov rax, 2
+  push rax
+  lea rax, .L_S_263[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 350
+  // tester.c:350
+  mov rax, 3
+  push rax
+  lea rax, .L_S_264[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 351
+  // tester.c:351
+  mov rax, 3
+  push rax
+  lea rax, .L_S_265[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 352
+  // tester.c:352
+  mov rax, 5
+  push rax
+  lea rax, .L_S_266[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 353
+  // tester.c:353
+  mov rax, 12
+  push rax
+  lea rax, .L_S_267[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 354
+  // tester.c:354
+  mov rax, 1
+  push rax
+  lea rax, .L_S_268[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 355
+  // tester.c:355
+  mov rax, 1
+  push rax
+  lea rax, .L_S_269[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 356
+  // tester.c:356
+  mov rax, 8
+  push rax
+  lea rax, .L_S_270[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 357
+  // tester.c:357
+  mov rax, 6
+  push rax
+  lea rax, .L_S_271[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 358
+  // tester.c:358
+  mov rax, 6
+  push rax
+  lea rax, .L_S_272[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 359
+  // tester.c:359
+  mov rax, 6
+  push rax
+  lea rax, .L_S_273[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 360
+  // tester.c:360
+  mov rax, 0
+  push rax
+  lea rax, .L_S_274[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 361
+  // tester.c:361
+  mov rax, 1
+  push rax
+  lea rax, .L_S_275[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 362
+  // tester.c:362
+  mov rax, 70
+  push rax
+  lea rax, .L_S_276[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 363
+  // tester.c:363
+  mov rax, 0
+  push rax
+  lea rax, .L_S_277[rip]
+  push rax
+  lea rax, .L_S_278[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_stdout
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 364
+  // tester.c:364
+  mov rax, 0
+  push rax
+  lea rax, .L_S_279[rip]
+  push rax
+  lea rax, .L_S_280[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_stdout
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 365
+  // tester.c:365
+  mov rax, 0
+  push rax
+  lea rax, .L_S_281[rip]
+  push rax
+  lea rax, .L_S_282[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_stdout
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 366
+  // tester.c:366
+  mov rax, 3
+  push rax
+  lea rax, .L_S_283[rip]
+  push rax
+  lea rax, .L_S_284[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file_inc
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 367
+  // tester.c:367
+  mov rax, 0
+  push rax
+  lea rax, .L_S_285[rip]
+  push rax
+  lea rax, .L_S_286[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_stdout
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 368
+  // tester.c:368
+  mov rax, 0
+  push rax
+  lea rax, .L_S_287[rip]
+  push rax
+  lea rax, .L_S_288[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_stdout
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 369
+  // tester.c:369
+  mov rax, 12
+  push rax
+  lea rax, .L_S_289[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 370
+  // tester.c:370
+  mov rax, 20
+  push rax
+  lea rax, .L_S_290[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 371
+  // tester.c:371
+  mov rax, 107
+  push rax
+  lea rax, .L_S_291[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 372
+  // tester.c:372
+  mov rax, 107
+  push rax
+  lea rax, .L_S_292[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 373
+  // tester.c:373
+  mov rax, 110
+  push rax
+  lea rax, .L_S_293[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 374
+  // tester.c:374
+  mov rax, 110
+  push rax
+  lea rax, .L_S_294[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 375
+  // tester.c:375
+  mov rax, 134
+  push rax
+  lea rax, .L_S_295[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 376
+  // tester.c:376
+  mov rax, 134
+  push rax
+  lea rax, .L_S_296[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 377
+  // tester.c:377
+  mov rax, 11
+  push rax
+  lea rax, .L_S_297[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 378
+  // tester.c:378
+  mov rax, 24
+  push rax
+  lea rax, .L_S_298[rip]
+  push rax
+  lea rax, .L_S_299[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_stdout
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 379
+  // tester.c:379
+  mov rax, 45
+  push rax
+  lea rax, .L_S_300[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 380
+  // tester.c:380
+  mov rax, 1
+  push rax
+  lea rax, .L_S_301[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 381
+  // tester.c:381
+  mov rax, 1
+  push rax
+  lea rax, .L_S_302[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 382
+  // tester.c:382
+  mov rax, 4
+  push rax
+  lea rax, .L_S_303[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 383
+  // tester.c:383
+  mov rax, 1
+  push rax
+  lea rax, .L_S_304[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 384
+  // tester.c:384
+  mov rax, 1
+  push rax
+  lea rax, .L_S_305[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 385
+  // tester.c:385
+  mov rax, 1
+  push rax
+  lea rax, .L_S_306[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 386
+  // tester.c:386
+  mov rax, 1
+  push rax
+  lea rax, .L_S_307[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 387
+  // tester.c:387
+  mov rax, 1
+  push rax
+  lea rax, .L_S_308[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 388
+  // tester.c:388
+  mov rax, 1
+  push rax
+  lea rax, .L_S_309[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 389
+  // tester.c:389
+  mov rax, 1
+  push rax
+  lea rax, .L_S_310[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 390
+  // tester.c:390
+  mov rax, 1
+  push rax
+  lea rax, .L_S_311[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 391
+  // tester.c:391
+  mov rax, 1
+  push rax
+  lea rax, .L_S_312[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 392
+  // tester.c:392
+  mov rax, 0
+  push rax
+  lea rax, .L_S_313[rip]
+  push rax
+  lea rax, .L_S_314[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_stdout
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 393
+  // tester.c:393
+  mov rax, 0
+  push rax
+  lea rax, .L_S_315[rip]
+  push rax
+  lea rax, .L_S_316[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_stdout
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 394
+  // tester.c:394
+  mov rax, 0
+  push rax
+  lea rax, .L_S_317[rip]
+  push rax
+  lea rax, .L_S_318[rip]
+  push rax
+  pop rax
+  mov rdx,rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_stdout
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 395
+  // tester.c:395
+  mov rax, 0
+  push rax
+  lea rax, .L_S_319[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 396
+  // tester.c:396
+  mov rax, 0
+  push rax
+  lea rax, .L_S_320[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 397
+  // tester.c:397
+  mov rax, 1
+  push rax
+  lea rax, .L_S_321[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 398
+  // tester.c:398
+  mov rax, 1
+  push rax
+  lea rax, .L_S_322[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 399
+  // tester.c:399
+  mov rax, 0
+  push rax
+  lea rax, .L_S_323[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 400
+  // tester.c:400
+  mov rax, 1
+  push rax
+  lea rax, .L_S_324[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 401
+  // tester.c:401
+  mov rax, 1
+  push rax
+  lea rax, .L_S_325[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 402
+  // tester.c:402
+  mov rax, 1
+  push rax
+  lea rax, .L_S_326[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 403
+  // tester.c:403
+  mov rax, 1
+  push rax
+  lea rax, .L_S_327[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 404
+  // tester.c:404
+  mov rax, 2
+  push rax
+  lea rax, .L_S_328[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 405
+  // tester.c:405
+  mov rax, 42
+  push rax
+  lea rax, .L_S_329[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 406
+  // tester.c:406
+  mov rax, 1
+  push rax
+  lea rax, .L_S_330[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 407
+  // tester.c:407
+  mov rax, 1
+  push rax
+  lea rax, .L_S_331[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 408
+  // tester.c:408
+  mov rax, 1
+  push rax
+  lea rax, .L_S_332[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 409
+  // tester.c:409
+  mov rax, 0
+  push rax
+  lea rax, .L_S_333[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 410
+  // tester.c:410
+  mov rax, 1
+  push rax
+  lea rax, .L_S_334[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 411
+  // tester.c:411
+  mov rax, 0
+  push rax
+  lea rax, .L_S_335[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 412
+  // tester.c:412
+  mov rax, 1
+  push rax
+  lea rax, .L_S_336[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 413
+  // tester.c:413
+  mov rax, 1
+  push rax
+  lea rax, .L_S_337[rip]
+  push rax
+  pop rax
+  mov rsi,rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call assert_file
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 414
+  // tester.c:414
+  lea rax, .L_S_338[rip]
+  push rax
+  pop rax
+  mov rdi,rax
+  mov r15,rsp
+  and rsp,~0xf
+  mov al,0
+  call printf
+  mov rsp,r15
+  push rax
+  pop rax
+  .loc 1 415
+  // tester.c:415
+  mov rax, 0
+  push rax
+  pop rax
+  mov rsp,rbp
+  pop rbx
+  pop r15
+  pop rbp
+  ret
+  pop rax
+  push rax
+  pop rax
+  mov rsp,rbp
+  pop rbx
+  pop r15
+  pop rbp
+  ret
@@ -0,0 +1,2 @@
+#include <string.h>
+int main(){int a=-839970252;unsigned char *p=(unsigned char*)&a;return memcmp(p, "\x34\x12\xef\xcd", 4) == 0;}
\ No newline at end of file
@@ -0,0 +1,342 @@
+.intel_syntax noprefix
+.section .rodata
+  .file 1 "t3.c"
+  .loc 1 1
+  // t3.c:1
+.text
+.type g, @function
+g:
+  .cfi_startproc
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp,rsp
+  .cfi_def_cfa_register rbp
+.Ltail_call_1:
+  // allocate stack
+  sub rsp,8
+  // save argument 0: x
+  mov rax, rdi
+  movsx rax, eax
+  mov r10, rax
+  // scope
+  // scope
+  .loc 1 1
+  // t3.c:1
+  // compound 2
+  .loc 1 1
+  // t3.c:1
+  // access v
+  mov rax, rbp
+  sub rax,8
+  push rax
+  push r10
+  pop rax
+  // convert from signed int to signed int
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  pop rax
+  push rax
+  pop rax
+  .loc 1 1
+  // t3.c:1
+  // access v
+  mov rax, rbp
+  sub rax,8
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  pop rax
+  lea rax, [rax+rax*2]
+  push rax
+  // access v
+  mov rax, rbp
+  sub rax,8
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  pop rsi
+  pop rax
+  // add type:3
+  add rax,rsi
+  push rax
+  pop rax
+  .cfi_remember_state
+  mov rsp,rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_restore_state
+  pop rax
+  push rax
+  pop rax
+  .cfi_remember_state
+  mov rsp,rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_restore_state
+  .cfi_endproc
+.size g, .-g
+  .loc 1 1
+  // t3.c:1
+.text
+.globl main
+.type main, @function
+main:
+  .cfi_startproc
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  push rbx
+  .cfi_def_cfa_offset 24
+  .cfi_offset rbx, -24
+  push r12
+  .cfi_def_cfa_offset 32
+  .cfi_offset r12, -32
+  push r13
+  .cfi_def_cfa_offset 40
+  .cfi_offset r13, -40
+  push r14
+  .cfi_def_cfa_offset 48
+  .cfi_offset r14, -48
+  mov rbp,rsp
+  .cfi_def_cfa_register rbp
+.Ltail_call_2:
+  // allocate stack
+  sub rsp,280
+  // scope
+  // scope
+  .loc 1 1
+  // t3.c:1
+  // compound 6
+  .loc 1 1
+  // t3.c:1
+  // inline g
+  // compound 1
+  // access x
+  mov rax, rbp
+  sub rax,276
+  push rax
+  mov rax, 5
+  push rax
+  pop rax
+  // convert from signed int to signed int
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  pop rax
+  push rax
+  pop rax
+  // scope
+  // scope
+  .loc 1 1
+  // t3.c:1
+  // compound 2
+  .loc 1 1
+  // t3.c:1
+  // access x
+  mov rax, rbp
+  sub rax,276
+  push rax
+  pop rax
+  mov eax, dword ptr[rax]
+  movsx rax, eax
+  push rax
+  pop rax
+  // convert from signed int to signed int
+  push rax
+  pop rax
+  movsx rax, eax
+  mov r13, rax
+  push rax
+  pop rax
+  push rax
+  pop rax
+  .loc 1 1
+  // t3.c:1
+  push r13
+  pop rax
+  lea rax, [rax+rax*2]
+  push rax
+  push r13
+  pop rsi
+  pop rax
+  // add type:3
+  add rax,rsi
+  push rax
+  pop rax
+  jmp .Linline_ret_3
+  pop rax
+  push rax
+  pop rax
+.Linline_ret_3:
+  push rax
+  pop rax
+  // convert from signed int to signed int
+  push rax
+  pop rax
+  movsx rax, eax
+  mov r14, rax
+  push rax
+  pop rax
+  push rax
+  pop rax
+  .loc 1 1
+  // t3.c:1
+  mov rax,0
+  push rax
+  pop rax
+  push rax
+  pop rax
+  .loc 1 1
+  // t3.c:1
+  mov rax, 0
+  push rax
+  pop rax
+  // convert from signed int to signed int
+  push rax
+  pop rax
+  movsx rax, eax
+  mov rbx, rax
+  push rax
+  pop rax
+  push rax
+  pop rax
+  .loc 1 1
+  // t3.c:1
+  sub rsp,8
+  lea rax, .L_S_1[rip]
+  mov rsi, rax
+  lea rax, .L_S_0[rip]
+  mov rdi, rax
+  mov al,0
+  call fopen
+  add rsp,8
+  push rax
+  pop rax
+  mov r12, rax
+  push rax
+  pop rax
+  push rax
+  pop rax
+  jmp .Lcontinue_1
+  .p2align 4,,10
+.L4:
+  // scope
+  .loc 1 1
+  // t3.c:1
+  // compound 1
+  # if cond
+  .loc 1 1
+  // t3.c:1
+  sub rsp,8
+  lea rax, .L_S_2[rip]
+  mov rsi, rax
+  lea rax, [rbp-260]
+  mov rdi, rax
+  mov al,0
+  call strstr
+  add rsp,8
+  push rax
+  pop rax
+  test rax, rax
+  jz .L5
+  # if stmt
+  // scope
+  .loc 1 1
+  // t3.c:1
+  // compound 1
+  .loc 1 1
+  // t3.c:1
+  mov rax, rbx
+  push rax
+  add rax, 1
+  movsx rax, eax
+  mov rbx, rax
+  pop rax
+  push rax
+  # else empty
+  jmp .L6
+.L5:
+  # dummy else statement
+  push 0
+.L6:
+  # if end
+  pop rax
+  push rax
+  pop rax
+.Lcontinue_1:
+  sub rsp,8
+  mov rax, r12
+  mov rdx, rax
+  mov rax, 256
+  mov rsi, rax
+  lea rax, [rbp-260]
+  mov rdi, rax
+  mov al,0
+  call fgets
+  add rsp,8
+  push rax
+  pop rax
+  test rax, rax
+  jnz .L4
+  .Lbreak_1:
+  push rax
+  pop rax
+  .loc 1 1
+  // t3.c:1
+  push rbx
+  pop rax
+  lea rax, [rax+rax*4]
+  shl rax, 1
+  push rax
+  push r14
+  pop rsi
+  pop rax
+  // add type:3
+  add rax,rsi
+  push rax
+  pop rax
+  .cfi_remember_state
+  mov rsp,rbp
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_restore_state
+  pop rax
+  push rax
+  pop rax
+  .cfi_remember_state
+  mov rsp,rbp
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_restore_state
+  .cfi_endproc
+.size main, .-main
+.section .rodata.str1.1,"aMS",@progbits,1
+.L_S_0:
+  .string "tmp.s"
+.L_S_1:
+  .string "r"
+.L_S_2:
+  .string "access v\n"
+.section .rodata
@@ -0,0 +1,3 @@
+
+
+int func(){return __LINE__;}
@@ -290,6 +290,9 @@ Token *tokenize(char *p){
                 { "restrict", TK_RESTRICT },
                 { "volatile", TK_VOLATILE },
                 { "inline", TK_INLINE },
+                { "_Alignas", TK_ALIGNAS },
+                { "__attribute__", TK_ATTRIBUTE },
+                { "_Noreturn", TK_NORETURN },
                 { "return", TK_RETURN },
                 { "if", TK_IF },
                 { "else", TK_ELSE },